@@ -0,0 +1,56 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/can.hpp>
+#include <libhal/units.hpp>
+
+#include "../resource_list.hpp"
+
+// can::send frame rate on a bus with at least one other node to
+// acknowledge frames. Result line:
+//
+//   can,baud=<rate>,frames=<count>,seconds=<s>,frames_per_sec=<rate>
+hal::status application(resource_list& p_resources)
+{
+  using namespace hal::literals;
+
+  auto& console = *p_resources.console;
+  auto& clock = *p_resources.clock;
+  auto& can = *p_resources.can;
+
+  constexpr hal::hertz baud_rate = 1.0_MHz;
+  constexpr size_t frames = 1000;
+  const hal::can::message_t message{
+    .id = 0x111,
+    .payload = { 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF, 0x00, 0x11 },
+    .length = 8,
+  };
+
+  HAL_CHECK(can.configure({ .baud_rate = baud_rate }));
+
+  stopwatch timer(clock);
+  for (size_t index = 0; index < frames; index++) {
+    HAL_CHECK(can.send(message));
+  }
+  auto seconds = timer.elapsed_seconds();
+
+  HAL_CHECK(print(console,
+                  "can,baud=%.0f,frames=%zu,seconds=%f,frames_per_sec=%.0f\n",
+                  baud_rate,
+                  frames,
+                  seconds,
+                  static_cast<float>(frames) / seconds));
+
+  return hal::success();
+}
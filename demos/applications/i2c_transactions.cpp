@@ -0,0 +1,62 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/i2c.hpp>
+#include <libhal/timeout.hpp>
+#include <libhal/units.hpp>
+
+#include "../resource_list.hpp"
+
+// i2c::transaction rate against a device that acknowledges at
+// resource_list::i2c_address. Each transaction writes one byte and reads
+// two back, a typical register read. Result line per clock rate:
+//
+//   i2c,clock_hz=<rate>,transactions=<count>,seconds=<s>,
+//   transactions_per_sec=<rate>
+hal::status application(resource_list& p_resources)
+{
+  using namespace hal::literals;
+
+  auto& console = *p_resources.console;
+  auto& clock = *p_resources.clock;
+  auto& i2c = *p_resources.i2c;
+
+  constexpr std::array<hal::hertz, 2> clock_rates{ 100.0_kHz, 1.0_MHz };
+  constexpr size_t transactions = 1000;
+  constexpr std::array<hal::byte, 1> register_address{ 0x00 };
+  std::array<hal::byte, 2> register_value{};
+
+  for (auto clock_rate : clock_rates) {
+    HAL_CHECK(i2c.configure({ .clock_rate = clock_rate }));
+
+    stopwatch timer(clock);
+    for (size_t index = 0; index < transactions; index++) {
+      HAL_CHECK(i2c.transaction(p_resources.i2c_address,
+                                register_address,
+                                register_value,
+                                hal::never_timeout()));
+    }
+    auto seconds = timer.elapsed_seconds();
+
+    HAL_CHECK(print(console,
+                    "i2c,clock_hz=%.0f,transactions=%zu,seconds=%f,"
+                    "transactions_per_sec=%.0f\n",
+                    clock_rate,
+                    transactions,
+                    seconds,
+                    static_cast<float>(transactions) / seconds));
+  }
+
+  return hal::success();
+}
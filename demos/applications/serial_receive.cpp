@@ -0,0 +1,63 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/serial.hpp>
+#include <libhal/units.hpp>
+
+#include "../resource_list.hpp"
+
+// Serial receive throughput and drop counting at high baud. Connect a
+// sender that saturates the port under test, then read for a fixed
+// window. Bytes are dropped whenever read_t::available exceeds
+// read_t::capacity. Result line:
+//
+//   serial,baud=<rate>,seconds=<s>,bytes=<total>,dropped=<count>
+hal::status application(resource_list& p_resources)
+{
+  using namespace hal::literals;
+  using namespace std::chrono_literals;
+
+  auto& console = *p_resources.console;
+  auto& clock = *p_resources.clock;
+  auto& serial = *p_resources.serial;
+
+  constexpr hal::hertz baud_rate = 921600.0f;
+  constexpr float window_seconds = 5.0f;
+
+  HAL_CHECK(serial.configure({ .baud_rate = baud_rate }));
+  HAL_CHECK(serial.flush());
+
+  std::array<hal::byte, 512> buffer{};
+  size_t total_bytes = 0;
+  size_t dropped_bytes = 0;
+
+  stopwatch timer(clock);
+  while (timer.elapsed_seconds() < window_seconds) {
+    auto response = HAL_CHECK(serial.read(buffer));
+    total_bytes += response.data.size();
+    if (response.available > response.capacity) {
+      dropped_bytes += response.available - response.capacity;
+    }
+  }
+  auto seconds = timer.elapsed_seconds();
+
+  HAL_CHECK(print(console,
+                  "serial,baud=%.0f,seconds=%f,bytes=%zu,dropped=%zu\n",
+                  baud_rate,
+                  seconds,
+                  total_bytes,
+                  dropped_bytes));
+
+  return hal::success();
+}
@@ -0,0 +1,61 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/spi.hpp>
+#include <libhal/units.hpp>
+
+#include "../resource_list.hpp"
+
+// Sustained spi::transfer throughput at several clock rates. Each line:
+//
+//   spi,clock_hz=<rate>,bytes=<total>,seconds=<s>,bytes_per_sec=<rate>
+hal::status application(resource_list& p_resources)
+{
+  using namespace hal::literals;
+
+  auto& console = *p_resources.console;
+  auto& clock = *p_resources.clock;
+  auto& spi = *p_resources.spi;
+
+  constexpr std::array<hal::hertz, 4> clock_rates{
+    250.0_kHz, 1.0_MHz, 4.0_MHz, 8.0_MHz
+  };
+  constexpr size_t transfers = 256;
+  std::array<hal::byte, 256> data_out{};
+  std::array<hal::byte, 256> data_in{};
+  for (size_t index = 0; index < data_out.size(); index++) {
+    data_out[index] = static_cast<hal::byte>(index);
+  }
+
+  for (auto clock_rate : clock_rates) {
+    HAL_CHECK(spi.configure({ .clock_rate = clock_rate }));
+
+    stopwatch timer(clock);
+    for (size_t index = 0; index < transfers; index++) {
+      HAL_CHECK(spi.transfer(data_out, data_in));
+    }
+    auto seconds = timer.elapsed_seconds();
+
+    auto total_bytes = transfers * data_out.size();
+    HAL_CHECK(print(console,
+                    "spi,clock_hz=%.0f,bytes=%zu,seconds=%f,"
+                    "bytes_per_sec=%.0f\n",
+                    clock_rate,
+                    total_bytes,
+                    seconds,
+                    static_cast<float>(total_bytes) / seconds));
+  }
+
+  return hal::success();
+}
@@ -14,8 +14,20 @@
 
 #include <libhal/error.hpp>
 
+#include "resource_list.hpp"
+
 int main()
 {
+  auto resources = initialize_platform();
+  if (!resources) {
+    hal::halt();
+  }
+
+  auto application_status = application(resources.value());
+  if (!application_status) {
+    hal::halt();
+  }
+
   return 0;
 }
 
@@ -0,0 +1,31 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "resource_list.hpp"
+
+// Stub platform. Replace this translation unit with one from your platform
+// library that constructs the drivers under test and fills out the
+// resource_list, for example:
+//
+//   hal::result<resource_list> initialize_platform()
+//   {
+//     static my_platform::uart uart0(/* ... */);
+//     static my_platform::spi spi2(/* ... */);
+//     ...
+//     return resource_list{ .console = &uart0, .spi = &spi2, /* ... */ };
+//   }
+hal::result<resource_list> initialize_platform()
+{
+  return hal::new_error(std::errc::not_supported);
+}
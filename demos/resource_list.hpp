@@ -0,0 +1,123 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+
+#include <libhal/can.hpp>
+#include <libhal/error.hpp>
+#include <libhal/i2c.hpp>
+#include <libhal/serial.hpp>
+#include <libhal/spi.hpp>
+#include <libhal/steady_clock.hpp>
+
+/**
+ * @brief The set of platform resources used by the benchmark applications
+ *
+ * Vendors qualifying a libhal implementation provide these from their
+ * platform library in initialize_platform(). Resources not exercised by the
+ * application being built may be left as nullptr.
+ */
+struct resource_list
+{
+  /// Console used to report benchmark results
+  hal::serial* console = nullptr;
+  /// Steady clock used to measure benchmark durations
+  hal::steady_clock* clock = nullptr;
+  /// Bus under test for the spi throughput benchmark
+  hal::spi* spi = nullptr;
+  /// Bus under test for the i2c transaction benchmark
+  hal::i2c* i2c = nullptr;
+  /// Address of a device that acknowledges on the i2c bus under test
+  hal::byte i2c_address = 0x00;
+  /// Port under test for the serial receive benchmark
+  hal::serial* serial = nullptr;
+  /// Bus under test for the can send benchmark
+  hal::can* can = nullptr;
+};
+
+/**
+ * @brief Acquire the resources of the platform under test
+ *
+ * Implemented by the platform library linked into each benchmark
+ * application. The upstream platform.cpp stub fails with
+ * `std::errc::not_supported`; replace it with your platform's
+ * implementation to run the benchmarks on target.
+ */
+hal::result<resource_list> initialize_platform();
+
+/**
+ * @brief The benchmark application, one implementation per executable
+ *
+ */
+hal::status application(resource_list& p_resources);
+
+/**
+ * @brief Print a formatted line to the result console
+ *
+ * Benchmark results use comma separated `label,key=value,...` lines so
+ * that qualification tooling can parse them without per-platform changes.
+ */
+inline hal::status print(hal::serial& p_console, const char* p_format, ...)
+{
+  std::array<char, 128> buffer{};
+  va_list arguments;
+  va_start(arguments, p_format);
+  int length =
+    std::vsnprintf(buffer.data(), buffer.size(), p_format, arguments);
+  va_end(arguments);
+  if (length < 0) {
+    return hal::new_error(std::errc::invalid_argument);
+  }
+  auto clamped_length = std::min(static_cast<size_t>(length), buffer.size());
+  auto remaining =
+    std::span(reinterpret_cast<const hal::byte*>(buffer.data()),
+              clamped_length);
+  while (!remaining.empty()) {
+    auto response = HAL_CHECK(p_console.write(remaining));
+    remaining = remaining.subspan(response.data.size());
+  }
+  return hal::success();
+}
+
+/**
+ * @brief Measure elapsed seconds on the platform clock
+ *
+ */
+class stopwatch
+{
+public:
+  explicit stopwatch(hal::steady_clock& p_clock)
+    : m_clock(&p_clock)
+    , m_start(p_clock.uptime().ticks)
+  {
+  }
+
+  [[nodiscard]] float elapsed_seconds() const
+  {
+    auto ticks = m_clock->uptime().ticks - m_start;
+    return static_cast<float>(ticks) /
+           m_clock->frequency().operating_frequency;
+  }
+
+private:
+  hal::steady_clock* m_clock;
+  std::uint64_t m_start;
+};
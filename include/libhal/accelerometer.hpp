@@ -14,8 +14,12 @@
 
 #pragma once
 
+#include <span>
+
 #include "error.hpp"
+#include "sampling.hpp"
 #include "units.hpp"
+#include "vec3.hpp"
 
 namespace hal {
 /**
@@ -27,29 +31,53 @@ public:
   /**
    * @brief Result from reading the accelerometer.
    *
+   * Acceleration in each axis is measured in g-force (hal::g_force) relative
+   * to the device's reference frame. Shares the hal::vec3 layout with the
+   * other x/y/z sensor interfaces so fusion code can mix samples without
+   * layout conversions.
+   */
+  using read_t = vec3;
+
+  /**
+   * @brief Result from batch reading the accelerometer.
+   *
    */
-  struct read_t
+  struct batch_t
   {
     /**
-     * @brief Acceleration in the X axis, relative to the device's reference
-     * frame.
-     *
-     */
-    g_force x;
-    /**
-     * @brief Acceleration in the Y axis, relative to the device's reference
-     * frame.
+     * @brief The filled portion of the sample buffer passed to read()
      *
+     * The size of this span indicates the number of samples read, which may
+     * be less than the size of the buffer if the device's FIFO held fewer
+     * samples. The address points to the start of the buffer passed into the
+     * read() function.
      */
-    g_force y;
-    /**
-     * @brief Acceleration in the Z axis, relative to the device's reference
-     * frame.
-     *
-     */
-    g_force z;
+    std::span<read_t> data;
   };
 
+  /**
+   * @brief Negotiate the device's output data rate and resolution
+   *
+   * The caller states the ranges it can accept and the driver applies the
+   * nearest output data rate and resolution the device supports, reporting
+   * what was actually achieved. Knowing the true rate lets fusion code
+   * size its batch reads and filters exactly rather than oversampling.
+   * Implementing drivers must verify achievability before modifying the
+   * device, so a failed call leaves it unchanged.
+   *
+   * @param p_settings - acceptable sample rate and resolution ranges
+   * @return result<sampling_t> - the achieved operating point
+   * @throws std::errc::not_supported - if the device's operating point is
+   * fixed at initialization and cannot be renegotiated.
+   * @throws std::errc::invalid_argument - if no supported operating point
+   * falls within the requested ranges.
+   */
+  [[nodiscard]] result<sampling_t> configure(
+    const sampling_settings& p_settings)
+  {
+    return driver_configure(p_settings);
+  }
+
   /**
    * @brief Read the latest acceleration sensed by the device
    *
@@ -60,9 +88,40 @@ public:
     return driver_read();
   }
 
+  /**
+   * @brief Read a batch of acceleration samples from the device
+   *
+   * Use this in place of repeated calls to the single read() API when the
+   * device buffers samples in an on-chip FIFO. Implementations for such
+   * devices should override the default implementation and drain the FIFO in
+   * a single burst bus transfer, which costs one bus transaction for the
+   * whole batch rather than one per sample. The default implementation fills
+   * the buffer with repeated single reads.
+   *
+   * @param p_samples - buffer to fill with acceleration samples
+   * @return result<batch_t> - the filled portion of the buffer
+   */
+  [[nodiscard]] result<batch_t> read(std::span<read_t> p_samples)
+  {
+    return driver_read(p_samples);
+  }
+
   virtual ~accelerometer() = default;
 
 private:
   virtual result<read_t> driver_read() = 0;
+  virtual result<sampling_t> driver_configure(
+    const sampling_settings& p_settings)
+  {
+    (void)p_settings;
+    return hal::new_error(std::errc::not_supported);
+  }
+  virtual result<batch_t> driver_read(std::span<read_t> p_samples)
+  {
+    for (auto& sample : p_samples) {
+      sample = HAL_CHECK(driver_read());
+    }
+    return batch_t{ .data = p_samples };
+  }
 };
 }  // namespace hal
@@ -14,7 +14,14 @@
 
 #pragma once
 
+#include <cstdint>
+#include <limits>
+#include <span>
+
 #include "error.hpp"
+#include "functional.hpp"
+#include "sampling.hpp"
+#include "units.hpp"
 
 namespace hal {
 /**
@@ -47,6 +54,82 @@ public:
     float sample;
   };
 
+  /**
+   * @brief Result from burst sampling the adc.
+   *
+   */
+  struct burst_t
+  {
+    /**
+     * @brief The filled portion of the sample buffer passed to read()
+     *
+     * The size of this span indicates the number of samples taken. The
+     * address points to the start of the buffer passed into the read()
+     * function.
+     */
+    std::span<uint16_t> data;
+    /**
+     * @brief Number of significant bits in each sample
+     *
+     * Samples are right-justified, meaning a sample of all 1s in the lower
+     * `bits` bits represents the positive reference voltage Vcc. Is
+     * guaranteed by the implementing driver to be between 1 and 16.
+     */
+    uint8_t bits;
+  };
+
+  /**
+   * @brief Handler for streamed sample delivery
+   *
+   * The span passed to the handler is the half of the streaming ring buffer
+   * that has just been filled and is safe to process until the same half is
+   * reported again. Like interrupt pin handlers, this handler is typically
+   * invoked in interrupt context and must not block.
+   */
+  using stream_handler = void(std::span<uint16_t> p_samples);
+
+  /**
+   * @brief Feedback from starting a sample stream.
+   *
+   */
+  struct stream_t
+  {
+    /**
+     * @brief The actual sample rate achieved by the driver
+     *
+     * May differ from the requested rate due to clock divider granularity.
+     */
+    hertz sample_rate;
+    /**
+     * @brief Number of significant bits in each streamed sample
+     *
+     * Follows the same rules as burst_t::bits.
+     */
+    uint8_t bits;
+  };
+
+  /**
+   * @brief Negotiate the converter's sample rate and resolution
+   *
+   * The caller states the ranges it can accept and the driver applies the
+   * nearest operating point its hardware supports, reporting the rate and
+   * bit width actually achieved. Implementing drivers must verify that an
+   * operating point within the ranges exists before modifying the
+   * hardware, so a failed call leaves the converter unchanged.
+   *
+   * @param p_settings - acceptable sample rate and resolution ranges
+   * @return result<sampling_t> - the achieved operating point
+   * @throws std::errc::not_supported - if the driver's operating point is
+   * fixed at initialization and cannot be renegotiated.
+   * @throws std::errc::invalid_argument - if no supported operating point
+   * falls within the requested ranges.
+   */
+  [[nodiscard]] result<sampling_t> configure(
+    const sampling_settings& p_settings)
+  {
+    return driver_configure(p_settings);
+  }
+
   /**
    * @brief Sample the analog to digital converter and return the result
    *
@@ -57,9 +140,107 @@ public:
     return driver_read();
   }
 
+  /**
+   * @brief Sample the analog to digital converter repeatedly, filling the
+   * supplied buffer with raw fixed-width samples. This function will block
+   * until the buffer has been filled.
+   *
+   * Use this in place of repeated calls to the single read() API when
+   * sampling at high rates. Conversion of each raw sample into a voltage
+   * proportion is deferred to the consumer, which can batch or skip it.
+   * Implementations with hardware sequencers or DMA should override the
+   * default implementation so the entire burst costs a single call. The
+   * default implementation samples with the single read() API and scales
+   * each sample to 16 bits.
+   *
+   * @param p_samples - buffer to fill with raw samples
+   * @return result<burst_t> - the raw samples and their bit width
+   */
+  [[nodiscard]] result<burst_t> read(std::span<uint16_t> p_samples)
+  {
+    return driver_read(p_samples);
+  }
+
+  /**
+   * @brief Continuously sample the analog to digital converter into a ring
+   * buffer without further application involvement
+   *
+   * The driver fills the supplied ring buffer free-running, typically via
+   * DMA, and invokes the handler each time half of the buffer has been
+   * filled, alternating between the lower and upper halves. Sampling
+   * continues until stop() is called, another stream is started or the
+   * driver is destroyed. The buffer must stay alive for that entire
+   * duration.
+   *
+   * Calls to the single or burst read() APIs while a stream is running are
+   * driver-defined and should be avoided.
+   *
+   * @param p_buffer - ring buffer for the driver to fill. Must hold an even
+   * number of samples so it can be split into two halves.
+   * @param p_sample_rate - requested rate at which to take samples
+   * @param p_handler - invoked each time half of the ring buffer is ready
+   * @return result<stream_t> - the achieved sample rate and sample bit width
+   * @throws std::errc::not_supported - if the driver cannot stream samples
+   * in the background.
+   * @throws std::errc::invalid_argument - if the buffer length is odd or too
+   * small, or the sample rate cannot be achieved.
+   */
+  [[nodiscard]] result<stream_t> stream(std::span<uint16_t> p_buffer,
+                                        hertz p_sample_rate,
+                                        hal::callback<stream_handler> p_handler)
+  {
+    return driver_stream(p_buffer, p_sample_rate, p_handler);
+  }
+
+  /**
+   * @brief Stop a running sample stream
+   *
+   * Stops the free-running sampling started by stream(). After this call
+   * returns the handler will no longer be invoked and the ring buffer may be
+   * released. Calling this without a running stream has no effect.
+   *
+   * @return status - success or failure
+   * @throws std::errc::not_supported - if the driver cannot stream samples
+   * in the background.
+   */
+  [[nodiscard]] status stop()
+  {
+    return driver_stop();
+  }
+
   virtual ~adc() = default;
 
 private:
   virtual result<read_t> driver_read() = 0;
+  virtual result<sampling_t> driver_configure(
+    const sampling_settings& p_settings)
+  {
+    (void)p_settings;
+    return hal::new_error(std::errc::not_supported);
+  }
+  virtual result<stream_t> driver_stream(
+    std::span<uint16_t> p_buffer,
+    hertz p_sample_rate,
+    hal::callback<stream_handler> p_handler)
+  {
+    (void)p_buffer;
+    (void)p_sample_rate;
+    (void)p_handler;
+    return hal::new_error(std::errc::not_supported);
+  }
+  virtual status driver_stop()
+  {
+    return hal::new_error(std::errc::not_supported);
+  }
+  virtual result<burst_t> driver_read(std::span<uint16_t> p_samples)
+  {
+    constexpr auto full_scale =
+      static_cast<float>(std::numeric_limits<uint16_t>::max());
+    for (auto& sample : p_samples) {
+      auto read_response = HAL_CHECK(driver_read());
+      sample = static_cast<uint16_t>(read_response.sample * full_scale);
+    }
+    return burst_t{ .data = p_samples, .bits = 16 };
+  }
 };
 }  // namespace hal
@@ -0,0 +1,156 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @defgroup Async Async
+ * @file async.hpp
+ * @brief Provides awaitable wrappers over the bus and clock interfaces for
+ * use within hal::task coroutines.
+ */
+#pragma once
+
+#include <span>
+
+#include "error.hpp"
+#include "i2c.hpp"
+#include "serial.hpp"
+#include "spi.hpp"
+#include "steady_clock.hpp"
+#include "task.hpp"
+#include "timeout.hpp"
+#include "units.hpp"
+
+namespace hal {
+/**
+ * @ingroup Async
+ * @brief Awaitable i2c transaction for use within a hal::task
+ *
+ * Starts the transaction with i2c::transaction_async() and yields to the
+ * poller between polls of the returned worker, so the awaiting task only
+ * occupies the processor for the length of a single progress check per
+ * poll. Follows the same span lifetime and error semantics as the blocking
+ * transaction API.
+ *
+ * @param p_i2c - the i2c bus to perform the transaction on
+ * @param p_address - 7-bit address of the device to communicate with
+ * @param p_data_out - data to be written to the addressed device
+ * @param p_data_in - buffer to store read data from the addressed device
+ * @return task<i2c::transaction_t> - awaitable transaction
+ */
+[[nodiscard]] inline task<i2c::transaction_t> async_transaction(
+  i2c& p_i2c,
+  hal::byte p_address,
+  std::span<const hal::byte> p_data_out,
+  std::span<hal::byte> p_data_in)
+{
+  auto worker_result =
+    p_i2c.transaction_async(p_address, p_data_out, p_data_in);
+  if (!worker_result) {
+    co_return worker_result.error();
+  }
+  auto worker = std::move(worker_result).value();
+  while (true) {
+    auto state = worker();
+    if (!state) {
+      co_return state.error();
+    }
+    if (state.value() == work_state::finished) {
+      co_return i2c::transaction_t{};
+    }
+    co_await yield;
+  }
+}
+
+/**
+ * @ingroup Async
+ * @brief Awaitable spi transfer for use within a hal::task
+ *
+ * The spi interface has no background transfer API, so the transfer is
+ * performed with the blocking API on the task's first poll and finishes in
+ * that same poll. Provided so spi steps compose into the same coroutine
+ * sequences as the other awaitables.
+ *
+ * @param p_spi - the spi bus to perform the transfer on
+ * @param p_data_out - data to be written to the bus
+ * @param p_data_in - buffer to store read data from the bus
+ * @param p_filler - filler data placed on the bus when p_data_out has been
+ * exhausted
+ * @return task<spi::transfer_t> - awaitable transfer
+ */
+[[nodiscard]] inline task<spi::transfer_t> async_transfer(
+  spi& p_spi,
+  std::span<const hal::byte> p_data_out,
+  std::span<hal::byte> p_data_in,
+  hal::byte p_filler = spi::default_filler)
+{
+  co_return p_spi.transfer(p_data_out, p_data_in, p_filler);
+}
+
+/**
+ * @ingroup Async
+ * @brief Awaitable serial read that fills the buffer before finishing
+ *
+ * Reads whatever the serial driver has buffered on each poll and yields
+ * between polls until the supplied buffer has been filled. Follows the same
+ * frame error semantics as the blocking read API.
+ *
+ * @param p_serial - the serial port to read from
+ * @param p_buffer - buffer to fill with received bytes
+ * @return task<serial::read_t> - awaitable read whose data span covers the
+ * whole buffer once finished
+ */
+[[nodiscard]] inline task<serial::read_t> async_read(
+  serial& p_serial,
+  std::span<hal::byte> p_buffer)
+{
+  size_t filled = 0;
+  serial::read_t response{};
+  while (filled < p_buffer.size()) {
+    auto read_result = p_serial.read(p_buffer.subspan(filled));
+    if (!read_result) {
+      co_return read_result.error();
+    }
+    filled += read_result.value().data.size();
+    response = read_result.value();
+    if (filled < p_buffer.size()) {
+      co_await yield;
+    }
+  }
+  co_return serial::read_t{ .data = p_buffer,
+                            .available = response.available,
+                            .capacity = response.capacity };
+}
+
+/**
+ * @ingroup Async
+ * @brief Awaitable delay for use within a hal::task
+ *
+ * The coroutine counterpart of hal::delay: yields to the poller until the
+ * duration has elapsed rather than spinning on the clock, so other tasks
+ * run during the wait.
+ *
+ * @param p_clock - steady clock used to measure the passage of time
+ * @param p_duration - duration to wait for
+ * @return task<void> - awaitable delay
+ */
+[[nodiscard]] inline task<void> async_delay(steady_clock& p_clock,
+                                            hal::time_duration p_duration)
+{
+  hal::deadline expiry(p_clock, p_duration);
+  while (expiry()) {
+    co_await yield;
+  }
+  co_return hal::success();
+}
+}  // namespace hal
@@ -0,0 +1,317 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace hal {
+/**
+ * @brief Constexpr description of a bitfield within a register
+ *
+ * Declare fields once next to the register map and reuse them for every
+ * access:
+ *
+ *     struct pwm_reg
+ *     {
+ *       static constexpr auto duty = hal::bit_mask::from(0, 15);
+ *       static constexpr auto enable = hal::bit_mask::from(31);
+ *     };
+ */
+struct bit_mask
+{
+  /**
+   * @brief Position of the field's least significant bit
+   *
+   */
+  std::uint32_t position;
+  /**
+   * @brief Width of the field in bits
+   *
+   */
+  std::uint32_t width;
+
+  /**
+   * @brief Describe a field spanning an inclusive bit range
+   *
+   * @param p_from - first bit of the field
+   * @param p_to - last bit of the field
+   * @return bit_mask - description of the field
+   */
+  [[nodiscard]] static constexpr bit_mask from(size_t p_from, size_t p_to)
+  {
+    if (p_from > p_to) {
+      return bit_mask{
+        .position = static_cast<std::uint32_t>(p_to),
+        .width = static_cast<std::uint32_t>(p_from - p_to + 1),
+      };
+    }
+    return bit_mask{
+      .position = static_cast<std::uint32_t>(p_from),
+      .width = static_cast<std::uint32_t>(p_to - p_from + 1),
+    };
+  }
+
+  /**
+   * @brief Describe a single-bit field
+   *
+   * @param p_bit - position of the bit
+   * @return bit_mask - description of the field
+   */
+  [[nodiscard]] static constexpr bit_mask from(size_t p_bit)
+  {
+    return bit_mask{
+      .position = static_cast<std::uint32_t>(p_bit),
+      .width = 1,
+    };
+  }
+
+  /**
+   * @brief The field's mask: its bits set, all others cleared
+   *
+   * For peripherals with dedicated set/clear registers this value can be
+   * stored directly, see bit_set() and bit_clear().
+   *
+   * @tparam T - unsigned register type
+   * @return T - mask with the field's bits set
+   */
+  template<typename T>
+  [[nodiscard]] constexpr T value() const
+  {
+    constexpr auto digits =
+      static_cast<std::uint32_t>(std::numeric_limits<T>::digits);
+    T field_ones;
+    if (width >= digits) {
+      field_ones = std::numeric_limits<T>::max();
+    } else {
+      field_ones = static_cast<T>((T{ 1 } << width) - T{ 1 });
+    }
+    return static_cast<T>(field_ones << position);
+  }
+};
+
+/**
+ * @brief Extract a field's value from a register image
+ *
+ * @param p_field - field to extract
+ * @param p_value - register value to extract from
+ * @return T - the field's value shifted down to bit zero
+ */
+template<typename T>
+[[nodiscard]] constexpr T bit_extract(bit_mask p_field, T p_value)
+{
+  return static_cast<T>((p_value & p_field.value<T>()) >> p_field.position);
+}
+
+/**
+ * @brief Compose a register value field by field without touching hardware
+ *
+ * Use for building a full register image in a plain variable, then store it
+ * to the volatile register with a single write:
+ *
+ *     auto control = hal::bit_value<std::uint32_t>()
+ *                      .insert(pwm_reg::duty, ticks)
+ *                      .set(pwm_reg::enable)
+ *                      .get();
+ *     registers->control = control;
+ *
+ * @tparam T - unsigned register type
+ */
+template<typename T = std::uint32_t>
+class bit_value
+{
+public:
+  constexpr explicit bit_value(T p_initial = 0)
+    : m_value(p_initial)
+  {
+  }
+
+  /**
+   * @brief Replace a field with a new value
+   *
+   * @param p_field - field to replace
+   * @param p_value - field value, taken from bit zero upward
+   */
+  constexpr bit_value& insert(bit_mask p_field, T p_value)
+  {
+    auto mask = p_field.value<T>();
+    m_value = static_cast<T>((m_value & ~mask) |
+                             ((p_value << p_field.position) & mask));
+    return *this;
+  }
+
+  /**
+   * @brief Set every bit of a field
+   *
+   */
+  constexpr bit_value& set(bit_mask p_field)
+  {
+    m_value = static_cast<T>(m_value | p_field.value<T>());
+    return *this;
+  }
+
+  /**
+   * @brief Clear every bit of a field
+   *
+   */
+  constexpr bit_value& clear(bit_mask p_field)
+  {
+    m_value = static_cast<T>(m_value & ~p_field.value<T>());
+    return *this;
+  }
+
+  /**
+   * @brief Toggle every bit of a field
+   *
+   */
+  constexpr bit_value& toggle(bit_mask p_field)
+  {
+    m_value = static_cast<T>(m_value ^ p_field.value<T>());
+    return *this;
+  }
+
+  /**
+   * @brief The composed register value
+   *
+   */
+  [[nodiscard]] constexpr T get() const
+  {
+    return m_value;
+  }
+
+private:
+  T m_value;
+};
+
+/**
+ * @brief Apply any number of field updates to a register in one
+ * read-modify-write
+ *
+ * Records inserts, sets, clears and toggles and commits them with a single
+ * volatile read and a single volatile write when the object goes out of
+ * scope, collapsing what would otherwise be one read-modify-write per
+ * field:
+ *
+ *     hal::bit_modify(registers->control)
+ *       .insert(pwm_reg::duty, ticks)
+ *       .set(pwm_reg::enable);
+ *     // committed here, one load and one store
+ *
+ * @tparam T - unsigned register type
+ */
+template<typename T>
+class bit_modify
+{
+public:
+  constexpr explicit bit_modify(volatile T& p_register)
+    : m_register(&p_register)
+  {
+  }
+
+  bit_modify(const bit_modify&) = delete;
+  bit_modify& operator=(const bit_modify&) = delete;
+  bit_modify(bit_modify&&) = delete;
+  bit_modify& operator=(bit_modify&&) = delete;
+
+  /**
+   * @brief Replace a field with a new value
+   *
+   * @param p_field - field to replace
+   * @param p_value - field value, taken from bit zero upward
+   */
+  constexpr bit_modify& insert(bit_mask p_field, T p_value)
+  {
+    auto mask = p_field.value<T>();
+    m_cleared = static_cast<T>(m_cleared | mask);
+    m_set = static_cast<T>((m_set & ~mask) |
+                           ((p_value << p_field.position) & mask));
+    return *this;
+  }
+
+  /**
+   * @brief Set every bit of a field
+   *
+   */
+  constexpr bit_modify& set(bit_mask p_field)
+  {
+    auto mask = p_field.value<T>();
+    m_cleared = static_cast<T>(m_cleared | mask);
+    m_set = static_cast<T>(m_set | mask);
+    return *this;
+  }
+
+  /**
+   * @brief Clear every bit of a field
+   *
+   */
+  constexpr bit_modify& clear(bit_mask p_field)
+  {
+    auto mask = p_field.value<T>();
+    m_cleared = static_cast<T>(m_cleared | mask);
+    m_set = static_cast<T>(m_set & ~mask);
+    return *this;
+  }
+
+  /**
+   * @brief Toggle every bit of a field
+   *
+   */
+  constexpr bit_modify& toggle(bit_mask p_field)
+  {
+    m_toggled = static_cast<T>(m_toggled ^ p_field.value<T>());
+    return *this;
+  }
+
+  ~bit_modify()
+  {
+    *m_register =
+      static_cast<T>(((*m_register & ~m_cleared) | m_set) ^ m_toggled);
+  }
+
+private:
+  volatile T* m_register;
+  T m_cleared = 0;
+  T m_set = 0;
+  T m_toggled = 0;
+};
+
+/**
+ * @brief Single-store fast path for dedicated write-one-to-set registers
+ *
+ * No read-modify-write: the field's mask is stored directly, which is both
+ * faster and interrupt safe on peripherals providing SET registers.
+ *
+ * @param p_set_register - the peripheral's SET register
+ * @param p_field - field to set
+ */
+template<typename T>
+void bit_set(volatile T& p_set_register, bit_mask p_field)
+{
+  p_set_register = p_field.value<T>();
+}
+
+/**
+ * @brief Single-store fast path for dedicated write-one-to-clear registers
+ *
+ * @param p_clear_register - the peripheral's CLEAR register
+ * @param p_field - field to clear
+ */
+template<typename T>
+void bit_clear(volatile T& p_clear_register, bit_mask p_field)
+{
+  p_clear_register = p_field.value<T>();
+}
+}  // namespace hal
@@ -0,0 +1,204 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @defgroup BufferedSerial Buffered Serial
+ * @file buffered_serial.hpp
+ * @brief Write-combining decorator for hal::serial.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "error.hpp"
+#include "serial.hpp"
+#include "steady_clock.hpp"
+#include "units.hpp"
+
+namespace hal {
+/**
+ * @ingroup BufferedSerial
+ * @brief Serial decorator that combines small writes into large flushes
+ *
+ * Subsystems that emit many small writes, such as text logging, pay a
+ * virtual call and, on interrupt or DMA driven drivers, a transmit setup
+ * per write. This decorator accumulates writes into a fixed internal
+ * buffer and hands the wrapped serial one large contiguous span when the
+ * buffer fills, when the oldest buffered byte exceeds the maximum age, or
+ * when drain() is called, amortizing the per-transfer overhead across the
+ * whole buffer.
+ *
+ * Writes at least as large as the buffer bypass it, after draining any
+ * pending bytes to preserve ordering. The age threshold is only evaluated
+ * when this object is entered, so a cooperative main loop should call
+ * service() periodically to bound how long a quiet log can sit buffered.
+ *
+ * Read-side operations are forwarded to the wrapped serial unchanged.
+ * Note that flush() follows the hal::serial contract and flushes the
+ * wrapped driver's receive buffer; drain() is the transmit-side flush.
+ *
+ * @tparam BufferSize - number of bytes accumulated before a flush
+ */
+template<size_t BufferSize = 256>
+class buffered_serial : public hal::serial
+{
+public:
+  static_assert(BufferSize > 0, "Buffer size must be non-zero");
+
+  /**
+   * @brief Construct the decorator around a serial driver
+   *
+   * @param p_serial - the serial driver to deliver combined writes to.
+   * Must outlive this object.
+   * @param p_clock - steady clock used to measure the age of buffered
+   * bytes. Must outlive this object.
+   * @param p_max_age - maximum time a buffered byte may wait before the
+   * next entry into this object forces a flush. A zero or negative
+   * duration flushes on every write, disabling combining.
+   */
+  buffered_serial(hal::serial& p_serial,
+                  hal::steady_clock& p_clock,
+                  hal::time_duration p_max_age)
+    : m_serial(&p_serial)
+    , m_clock(&p_clock)
+  {
+    constexpr float nanoseconds_per_second = 1'000'000'000.0f;
+    auto ticks_per_nanosecond =
+      p_clock.frequency().operating_frequency / nanoseconds_per_second;
+    auto duration_count = p_max_age < hal::time_duration::zero()
+                            ? std::int64_t{ 0 }
+                            : p_max_age.count();
+    m_max_age_ticks = static_cast<std::uint64_t>(
+      static_cast<float>(duration_count) * ticks_per_nanosecond);
+  }
+
+  /**
+   * @brief Deliver all buffered bytes to the wrapped serial
+   *
+   * Does nothing if the buffer is empty. On failure the undelivered bytes
+   * stay buffered and a later drain retries them.
+   *
+   * @return status - success or failure
+   */
+  [[nodiscard]] status drain()
+  {
+    std::span<const hal::byte> remaining(m_buffer.data(), m_size);
+    remaining = remaining.subspan(m_drained);
+    while (!remaining.empty()) {
+      auto write_result = m_serial->write(remaining);
+      if (!write_result) {
+        m_drained = m_size - remaining.size();
+        return write_result.error();
+      }
+      remaining = remaining.subspan(write_result.value().data.size());
+    }
+    m_size = 0;
+    m_drained = 0;
+    return hal::success();
+  }
+
+  /**
+   * @brief Flush the buffer if its oldest byte has exceeded the max age
+   *
+   * Call this periodically from the main loop so buffered bytes are
+   * delivered even when no further writes arrive.
+   *
+   * @return status - success or failure
+   */
+  [[nodiscard]] status service()
+  {
+    if (m_size > 0 &&
+        m_clock->uptime().ticks - m_first_byte_tick >= m_max_age_ticks) {
+      return drain();
+    }
+    return hal::success();
+  }
+
+  /**
+   * @brief Number of bytes currently buffered and not yet delivered
+   *
+   * @return size_t - number of pending bytes
+   */
+  [[nodiscard]] size_t pending() const
+  {
+    return m_size - m_drained;
+  }
+
+  ~buffered_serial() override = default;
+
+private:
+  status driver_configure(const settings& p_settings) override
+  {
+    return m_serial->configure(p_settings);
+  }
+
+  result<write_t> driver_write(std::span<const hal::byte> p_data) override
+  {
+    HAL_CHECK(service());
+    if (p_data.size() >= BufferSize) {
+      HAL_CHECK(drain());
+      auto remaining = p_data;
+      while (!remaining.empty()) {
+        auto write_result = HAL_CHECK(m_serial->write(remaining));
+        remaining = remaining.subspan(write_result.data.size());
+      }
+      return write_t{ .data = p_data };
+    }
+    if (p_data.size() > BufferSize - m_size) {
+      HAL_CHECK(drain());
+    }
+    if (m_size == 0) {
+      m_first_byte_tick = m_clock->uptime().ticks;
+    }
+    std::copy(p_data.begin(), p_data.end(), m_buffer.begin() + m_size);
+    m_size += p_data.size();
+    if (m_size == BufferSize) {
+      HAL_CHECK(drain());
+    }
+    return write_t{ .data = p_data };
+  }
+
+  result<read_t> driver_read(std::span<hal::byte> p_data) override
+  {
+    return m_serial->read(p_data);
+  }
+
+  result<borrow_t> driver_borrow() override
+  {
+    return m_serial->borrow();
+  }
+
+  status driver_consume(size_t p_count) override
+  {
+    return m_serial->consume(p_count);
+  }
+
+  result<flush_t> driver_flush() override
+  {
+    return m_serial->flush();
+  }
+
+  hal::serial* m_serial;
+  hal::steady_clock* m_clock;
+  std::array<hal::byte, BufferSize> m_buffer{};
+  std::uint64_t m_max_age_ticks;
+  std::uint64_t m_first_byte_tick{ 0 };
+  size_t m_size{ 0 };
+  size_t m_drained{ 0 };
+};
+}  // namespace hal
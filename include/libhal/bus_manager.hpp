@@ -0,0 +1,373 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @defgroup BusManager Bus Manager
+ * @file bus_manager.hpp
+ * @brief Provides cached-settings managers for shared i2c and spi buses.
+ */
+#pragma once
+
+#include <optional>
+#include <span>
+
+#include "error.hpp"
+#include "i2c.hpp"
+#include "output_pin.hpp"
+#include "spi.hpp"
+
+namespace hal {
+/**
+ * @ingroup BusManager
+ * @brief i2c decorator that skips redundant bus reconfiguration
+ *
+ * Wraps an i2c bus shared between multiple devices and tracks the settings
+ * most recently applied to it. Calls to configure() with settings matching
+ * the applied ones return immediately without touching the hardware, which
+ * avoids the cost of a full peripheral reconfiguration on each device
+ * handoff. Devices whose settings match, such as two sensors clocked at the
+ * same rate, can interleave transactions with zero reconfigure calls.
+ *
+ * Each device sharing the bus should be handed a reference to the same
+ * manager rather than the underlying bus. Configuring the underlying bus
+ * directly bypasses the cache and must be avoided, as the manager would skip
+ * a reconfigure it still believes has been applied.
+ */
+class i2c_bus_manager final : public i2c
+{
+public:
+  /**
+   * @brief Construct the manager around a shared i2c bus
+   *
+   * @param p_bus - the i2c bus to manage. Must outlive this object.
+   */
+  explicit i2c_bus_manager(i2c& p_bus)
+    : m_bus(&p_bus)
+  {
+  }
+
+private:
+  status driver_configure(const settings& p_settings) override
+  {
+    if (m_applied && m_applied->clock_rate == p_settings.clock_rate) {
+      return success();
+    }
+    // Invalidate the cache first so a failed reconfigure is retried rather
+    // than assumed applied.
+    m_applied = std::nullopt;
+    HAL_CHECK(m_bus->configure(p_settings));
+    m_applied = p_settings;
+    return success();
+  }
+
+  result<transaction_t> driver_transaction(
+    hal::byte p_address,
+    std::span<const hal::byte> p_data_out,
+    std::span<hal::byte> p_data_in,
+    hal::function_ref<hal::timeout_function> p_timeout) override
+  {
+    return m_bus->transaction(p_address, p_data_out, p_data_in, p_timeout);
+  }
+
+  result<transaction_worker> driver_transaction_async(
+    hal::byte p_address,
+    std::span<const hal::byte> p_data_out,
+    std::span<hal::byte> p_data_in) override
+  {
+    return m_bus->transaction_async(p_address, p_data_out, p_data_in);
+  }
+
+  result<transaction_t> driver_transaction(
+    std::span<const transaction_record> p_transactions,
+    hal::function_ref<hal::timeout_function> p_timeout) override
+  {
+    return m_bus->transaction(p_transactions, p_timeout);
+  }
+
+  i2c* m_bus;
+  std::optional<settings> m_applied{};
+};
+
+/**
+ * @ingroup BusManager
+ * @brief spi decorator that skips redundant bus reconfiguration
+ *
+ * The spi counterpart of hal::i2c_bus_manager, following the same rules:
+ * hand each device sharing the bus a reference to the same manager and do
+ * not configure the underlying bus directly.
+ */
+class spi_bus_manager final : public spi
+{
+public:
+  /**
+   * @brief Construct the manager around a shared spi bus
+   *
+   * @param p_bus - the spi bus to manage. Must outlive this object.
+   */
+  explicit spi_bus_manager(spi& p_bus)
+    : m_bus(&p_bus)
+  {
+  }
+
+private:
+  status driver_configure(const settings& p_settings) override
+  {
+    if (m_applied &&
+        m_applied->clock_rate == p_settings.clock_rate &&
+        m_applied->clock_idles_high == p_settings.clock_idles_high &&
+        m_applied->data_valid_on_trailing_edge ==
+          p_settings.data_valid_on_trailing_edge) {
+      return success();
+    }
+    // Invalidate the cache first so a failed reconfigure is retried rather
+    // than assumed applied.
+    m_applied = std::nullopt;
+    HAL_CHECK(m_bus->configure(p_settings));
+    m_applied = p_settings;
+    return success();
+  }
+
+  result<transfer_t> driver_transfer(std::span<const hal::byte> p_data_out,
+                                     std::span<hal::byte> p_data_in,
+                                     hal::byte p_filler) override
+  {
+    return m_bus->transfer(p_data_out, p_data_in, p_filler);
+  }
+
+  result<transfer_t> driver_transfer(
+    std::span<const transfer_segment> p_segments) override
+  {
+    return m_bus->transfer(p_segments);
+  }
+
+  spi* m_bus;
+  std::optional<settings> m_applied{};
+};
+
+class spi_device;
+
+/**
+ * @ingroup BusManager
+ * @brief Arbitrates a shared spi bus between chip-selected devices
+ *
+ * Construct one manager per physical bus and one spi_device per attached
+ * chip. The manager tracks which device's settings the bus currently
+ * carries, so reconfiguration happens only on an actual device switch, and
+ * which device holds its chip select during a multi-transfer transaction.
+ */
+class spi_device_manager
+{
+public:
+  /**
+   * @brief Construct the manager around a shared spi bus
+   *
+   * @param p_bus - the spi bus to manage. Must outlive this object.
+   */
+  explicit spi_device_manager(spi& p_bus)
+    : m_bus(&p_bus)
+  {
+  }
+
+private:
+  friend class spi_device;
+
+  spi* m_bus;
+  /// Device whose settings the bus hardware currently carries
+  const spi_device* m_configured = nullptr;
+  /// Device currently holding its chip select asserted
+  const spi_device* m_owner = nullptr;
+};
+
+/**
+ * @ingroup BusManager
+ * @brief A chip-selected device on a managed spi bus
+ *
+ * Implements hal::spi, so device drivers use it exactly like a dedicated
+ * bus: each transfer() asserts the device's active-low chip select, applies
+ * the device's settings if another device used the bus since, performs the
+ * transfer and releases the chip select. For command sequences that must
+ * stay selected across several transfers, begin_transaction() asserts the
+ * chip select once and holds it until the returned scope is destroyed,
+ * removing the per-transfer chip select toggling and reconfiguration
+ * entirely.
+ *
+ * The chip select pin must be configured as a plain output and driven high
+ * (deasserted) before the device is used.
+ */
+class spi_device final : public spi
+{
+public:
+  /**
+   * @brief Holds a device's chip select asserted across several transfers
+   *
+   * Obtained from begin_transaction(). While alive, transfers from the
+   * owning device proceed without touching the chip select and transfers
+   * from any other device on the bus fail with
+   * std::errc::device_or_resource_busy. The chip select deasserts when the
+   * scope is destroyed; that release is best effort, as destructors cannot
+   * report pin errors.
+   */
+  class transaction
+  {
+  public:
+    transaction(const transaction&) = delete;
+    transaction& operator=(const transaction&) = delete;
+
+    transaction(transaction&& p_other) noexcept
+      : m_device(p_other.m_device)
+    {
+      p_other.m_device = nullptr;
+    }
+
+    transaction& operator=(transaction&& p_other) noexcept
+    {
+      if (this != &p_other) {
+        release();
+        m_device = p_other.m_device;
+        p_other.m_device = nullptr;
+      }
+      return *this;
+    }
+
+    ~transaction()
+    {
+      release();
+    }
+
+  private:
+    friend class spi_device;
+
+    explicit transaction(spi_device* p_device)
+      : m_device(p_device)
+    {
+    }
+
+    void release();
+
+    spi_device* m_device;
+  };
+
+  /**
+   * @brief Register a device on a managed bus
+   *
+   * @param p_manager - manager of the bus the device is attached to. Must
+   * outlive this object.
+   * @param p_chip_select - the device's active-low chip select pin. Must
+   * outlive this object.
+   * @param p_settings - bus settings this device requires
+   */
+  spi_device(spi_device_manager& p_manager,
+             output_pin& p_chip_select,
+             const spi::settings& p_settings)
+    : m_manager(&p_manager)
+    , m_chip_select(&p_chip_select)
+    , m_settings(p_settings)
+  {
+  }
+
+  /**
+   * @brief Assert the chip select for a multi-transfer transaction
+   *
+   * Applies the device's settings if needed and asserts the chip select
+   * once; every transfer issued against this device until the returned
+   * scope is destroyed proceeds with the chip select held.
+   *
+   * @return result<transaction> - scope holding the chip select
+   * @throws std::errc::device_or_resource_busy - if another device already
+   * holds a transaction on this bus.
+   */
+  [[nodiscard]] result<transaction> begin_transaction()
+  {
+    if (m_manager->m_owner != nullptr) {
+      return hal::new_error(std::errc::device_or_resource_busy);
+    }
+    HAL_CHECK(apply_settings());
+    HAL_CHECK(m_chip_select->level(false));
+    m_manager->m_owner = this;
+    return transaction(this);
+  }
+
+private:
+  status apply_settings()
+  {
+    if (m_manager->m_configured != this) {
+      // Invalidate first so a failed reconfigure is retried rather than
+      // assumed applied.
+      m_manager->m_configured = nullptr;
+      HAL_CHECK(m_manager->m_bus->configure(m_settings));
+      m_manager->m_configured = this;
+    }
+    return success();
+  }
+
+  status driver_configure(const settings& p_settings) override
+  {
+    m_settings = p_settings;
+    if (m_manager->m_configured == this) {
+      m_manager->m_configured = nullptr;
+    }
+    return success();
+  }
+
+  result<transfer_t> driver_transfer(std::span<const hal::byte> p_data_out,
+                                     std::span<hal::byte> p_data_in,
+                                     hal::byte p_filler) override
+  {
+    if (m_manager->m_owner == this) {
+      return m_manager->m_bus->transfer(p_data_out, p_data_in, p_filler);
+    }
+    if (m_manager->m_owner != nullptr) {
+      return hal::new_error(std::errc::device_or_resource_busy);
+    }
+    HAL_CHECK(apply_settings());
+    HAL_CHECK(m_chip_select->level(false));
+    auto response = m_manager->m_bus->transfer(p_data_out, p_data_in, p_filler);
+    auto chip_select_status = m_chip_select->level(true);
+    HAL_CHECK(response);
+    HAL_CHECK(chip_select_status);
+    return response;
+  }
+
+  result<transfer_t> driver_transfer(
+    std::span<const transfer_segment> p_segments) override
+  {
+    if (m_manager->m_owner == this) {
+      return m_manager->m_bus->transfer(p_segments);
+    }
+    if (m_manager->m_owner != nullptr) {
+      return hal::new_error(std::errc::device_or_resource_busy);
+    }
+    HAL_CHECK(apply_settings());
+    HAL_CHECK(m_chip_select->level(false));
+    auto response = m_manager->m_bus->transfer(p_segments);
+    auto chip_select_status = m_chip_select->level(true);
+    HAL_CHECK(response);
+    HAL_CHECK(chip_select_status);
+    return response;
+  }
+
+  spi_device_manager* m_manager;
+  output_pin* m_chip_select;
+  spi::settings m_settings;
+};
+
+inline void spi_device::transaction::release()
+{
+  if (m_device != nullptr) {
+    (void)m_device->m_chip_select->level(true);
+    m_device->m_manager->m_owner = nullptr;
+    m_device = nullptr;
+  }
+}
+}  // namespace hal
@@ -0,0 +1,106 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @defgroup CachedSensor Cached Sensor
+ * @file cached_sensor.hpp
+ * @brief Provides a caching decorator for single-value sensor interfaces.
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "error.hpp"
+#include "steady_clock.hpp"
+#include "units.hpp"
+
+namespace hal {
+/**
+ * @ingroup CachedSensor
+ * @brief Sensor decorator that serves a cached sample within a max age
+ *
+ * Wraps any sensor interface whose read() takes no arguments and returns
+ * `result<read_t>`, such as hal::temperature_sensor, hal::current_sensor,
+ * hal::distance_sensor, hal::rotation_sensor, hal::accelerometer,
+ * hal::gyroscope and hal::magnetometer. When multiple subsystems share one
+ * physical device, hand each of them a reference to the same decorator:
+ * reads within the max age are served from the cached sample without
+ * touching the bus, so identical reads within one control tick cost one bus
+ * transaction instead of one per subsystem.
+ *
+ * Failed reads are not cached; the next read retries the device. Only the
+ * single-sample read() is cached and forwarded — optional capability APIs
+ * of the wrapped interface, such as batch reads, retain their default
+ * behavior on the decorator and should be called on the wrapped sensor
+ * directly.
+ *
+ * @tparam Sensor - the sensor interface to decorate
+ */
+template<class Sensor>
+class cached_sensor : public Sensor
+{
+public:
+  /**
+   * @brief Construct the decorator around a shared sensor
+   *
+   * @param p_sensor - the sensor to cache reads from. Must outlive this
+   * object.
+   * @param p_clock - steady clock used to measure the age of the cached
+   * sample. Must outlive this object.
+   * @param p_max_age - maximum age of the cached sample. Reads occurring
+   * within this duration of the previous device read are served from the
+   * cache. A zero or negative duration limits the cache to reads occurring
+   * on the same clock tick.
+   */
+  cached_sensor(Sensor& p_sensor,
+                hal::steady_clock& p_clock,
+                hal::time_duration p_max_age)
+    : m_sensor(&p_sensor)
+    , m_clock(&p_clock)
+  {
+    constexpr float nanoseconds_per_second = 1'000'000'000.0f;
+    auto ticks_per_nanosecond =
+      p_clock.frequency().operating_frequency / nanoseconds_per_second;
+    auto duration_count = p_max_age < hal::time_duration::zero()
+                            ? std::int64_t{ 0 }
+                            : p_max_age.count();
+    m_max_age_ticks = static_cast<std::uint64_t>(
+      static_cast<float>(duration_count) * ticks_per_nanosecond);
+  }
+
+  ~cached_sensor() override = default;
+
+private:
+  using read_t = typename Sensor::read_t;
+
+  result<read_t> driver_read() override
+  {
+    auto uptime = m_clock->uptime().ticks;
+    if (m_has_sample && uptime - m_sample_uptime <= m_max_age_ticks) {
+      return m_sample;
+    }
+    m_sample = HAL_CHECK(m_sensor->read());
+    m_sample_uptime = uptime;
+    m_has_sample = true;
+    return m_sample;
+  }
+
+  Sensor* m_sensor;
+  hal::steady_clock* m_clock;
+  std::uint64_t m_max_age_ticks;
+  std::uint64_t m_sample_uptime{ 0 };
+  read_t m_sample{};
+  bool m_has_sample{ false };
+};
+}  // namespace hal
@@ -14,11 +14,18 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
 
 #include "error.hpp"
 #include "functional.hpp"
+#include "instrumentation.hpp"
 #include "units.hpp"
 
 namespace hal {
@@ -102,6 +109,11 @@ public:
   /**
    * @brief A CAN message
    *
+   * The layout is fixed at 16 bytes of standard layout, trivially copyable
+   * data: id at offset 0, payload at offset 4, length at offset 12,
+   * is_remote_request at offset 13 and two zeroed reserved bytes at offset
+   * 14. Arrays of messages can therefore be moved with memcpy or DMA and
+   * written to binary logs portably. See message_bytes().
    */
   struct message_t
   {
@@ -128,6 +140,56 @@ public:
      * If true, then length and payload are ignored.
      */
     bool is_remote_request = false;
+    /**
+     * @brief Explicit padding out to 16 bytes
+     *
+     * Keeps the serialized form deterministic across compilers. Must be
+     * zero.
+     */
+    std::array<hal::byte, 2> reserved{};
+  };
+
+  static_assert(sizeof(message_t) == 16,
+                "can::message_t must be exactly 16 bytes");
+  static_assert(std::is_trivially_copyable_v<message_t>,
+                "can::message_t must be trivially copyable");
+  static_assert(std::is_standard_layout_v<message_t>,
+                "can::message_t must be standard layout");
+  static_assert(offsetof(message_t, id) == 0 &&
+                  offsetof(message_t, payload) == 4 &&
+                  offsetof(message_t, length) == 12 &&
+                  offsetof(message_t, is_remote_request) == 13 &&
+                  offsetof(message_t, reserved) == 14,
+                "can::message_t fields must sit at their documented offsets");
+
+  /**
+   * @brief An acceptance filter entry for received can messages
+   *
+   * A message is accepted by a filter entry when every bit of its ID selected
+   * by the mask matches the corresponding bit of the entry's ID, in other
+   * words when `(message.id & mask) == (id & mask)`.
+   */
+  struct filter_t
+  {
+    /**
+     * @brief ID bits that accepted messages must match
+     *
+     */
+    id_t id;
+    /**
+     * @brief Mask selecting which bits of the ID participate in matching
+     *
+     * Bits set to 1 must match between the message ID and the filter ID.
+     * Bits set to 0 are ignored. A mask of all 1s accepts exactly one ID and
+     * a mask of 0 accepts every message.
+     */
+    id_t mask;
+    /**
+     * @brief Set to true to match 29-bit extended IDs, false for 11-bit
+     * standard IDs
+     *
+     */
+    bool is_extended = false;
   };
 
   /**
@@ -145,6 +207,35 @@ public:
   struct send_t
   {};
 
+  /**
+   * @brief Return type for draining the receive queue
+   *
+   */
+  struct receive_t
+  {
+    /**
+     * @brief The filled portion of the buffer passed to receive()
+     *
+     * The size of this span indicates the number of messages dequeued. The
+     * address points to the start of the buffer passed into the receive()
+     * function.
+     */
+    std::span<message_t> data;
+    /**
+     * @brief Number of messages still waiting in the receive queue
+     *
+     */
+    size_t remaining;
+    /**
+     * @brief Number of messages lost since the last call to receive()
+     *
+     * Messages are lost when they arrive while the receive queue is full.
+     * Not all drivers can report lost messages, in which case this value will
+     * always be zero.
+     */
+    size_t dropped;
+  };
+
   /**
    * @brief Configure this can bus port to match the settings supplied
    *
@@ -200,7 +291,56 @@ public:
    */
   [[nodiscard]] result<send_t> send(const message_t& p_message)
   {
-    return driver_send(p_message);
+    instrument::scope telemetry(instrument::tag::can_send);
+    auto response = driver_send(p_message);
+    telemetry.complete(bool{ response }, p_message.length);
+    return response;
+  }
+
+  /**
+   * @brief Send a batch of can messages
+   *
+   * The default implementation sends each message with the single-message
+   * send() path, blocking on mailbox availability between frames. Drivers
+   * with a transmit queue (see attach_transmit_queue()) should override
+   * this to enqueue the whole batch in ID-priority order and return
+   * immediately, draining the queue into hardware mailboxes from the
+   * transmit-complete interrupt so the bus stays saturated during bursts.
+   *
+   * @param p_messages - the messages to be sent
+   * @return result<send_t> - success or failure
+   * @throws std::errc::network_down - if the can device is in the "bus-off"
+   * state, see send() for details.
+   */
+  [[nodiscard]] result<send_t> send(std::span<const message_t> p_messages)
+  {
+    return driver_send(p_messages);
+  }
+
+  /**
+   * @brief Provide storage for a priority-ordered transmit queue
+   *
+   * When a transmit queue is installed, send() calls that find the hardware
+   * mailboxes full enqueue the message by CAN ID priority (lower ID first,
+   * matching bus arbitration) rather than blocking, and the driver drains
+   * the queue from its transmit-complete interrupt. This guarantees that a
+   * low priority frame never holds the last mailbox ahead of a high
+   * priority one during a burst.
+   *
+   * The buffer must stay alive until the driver is destroyed or another
+   * buffer is installed. hal::can_transmit_queue provides the standard
+   * priority queue implementation for drivers to drain this storage with.
+   *
+   * @param p_buffer - storage for the transmit queue
+   * @return status - success or failure
+   * @throws std::errc::not_supported - if the driver can only send
+   * synchronously.
+   * @throws std::errc::invalid_argument - if the buffer is too small to
+   * hold at least one message.
+   */
+  [[nodiscard]] status attach_transmit_queue(std::span<message_t> p_buffer)
+  {
+    return driver_attach_transmit_queue(p_buffer);
   }
 
   /**
@@ -216,6 +356,79 @@ public:
     return driver_on_receive(p_handler);
   }
 
+  /**
+   * @brief Program the hardware acceptance filters for message reception
+   *
+   * Replaces any previously installed set of filters. A message is delivered
+   * to the application, via on_receive() or the receive queue, when it is
+   * accepted by at least one filter entry. Passing an empty span removes all
+   * filtering and accepts every message, which is also the state of a newly
+   * created driver.
+   *
+   * Implementations should program the peripheral's hardware mask/list
+   * filters so that rejected messages never raise an interrupt. The number of
+   * filter entries that can be installed is limited by the hardware.
+   *
+   * @param p_filters - list of acceptance filter entries
+   * @return status - success or failure
+   * @throws std::errc::not_supported - if the driver cannot perform
+   * acceptance filtering.
+   * @throws std::errc::invalid_argument - if the list contains more entries
+   * than the hardware has filter slots.
+   */
+  [[nodiscard]] status filter(std::span<const filter_t> p_filters)
+  {
+    return driver_filter(p_filters);
+  }
+
+  /**
+   * @brief Provide storage for queued message reception
+   *
+   * This is an alternative to on_receive() for applications that want to
+   * drain received messages from their main loop rather than execute logic
+   * in interrupt context. The supplied buffer is used by the driver as a
+   * single-producer single-consumer circular queue: reception (typically in
+   * an interrupt) only enqueues the message and returns, and the application
+   * drains the queue in batches with receive(). If a queue and an
+   * on_receive() handler are both installed, the one installed last receives
+   * the messages.
+   *
+   * The buffer must stay alive until the driver is destroyed or another
+   * buffer (or an on_receive() handler) is installed. Messages that arrive
+   * while the queue is full are dropped.
+   *
+   * @param p_buffer - storage for the receive queue. One element of the
+   * buffer is reserved to distinguish the queue's full and empty states, so
+   * a buffer of N messages queues up to N - 1 of them.
+   * @return status - success or failure
+   * @throws std::errc::not_supported - if the driver can only deliver
+   * messages through on_receive().
+   * @throws std::errc::invalid_argument - if the buffer is too small to hold
+   * at least one message.
+   */
+  [[nodiscard]] status attach_receive_queue(std::span<message_t> p_buffer)
+  {
+    return driver_attach_receive_queue(p_buffer);
+  }
+
+  /**
+   * @brief Drain messages from the receive queue into the supplied buffer
+   *
+   * Copies the oldest queued messages into p_messages, up to either the size
+   * of p_messages or the number of messages currently queued, whichever is
+   * smaller. May only be called after a queue has been installed with
+   * attach_receive_queue().
+   *
+   * @param p_messages - buffer to copy queued messages into
+   * @return result<receive_t> - can receive response
+   * @throws std::errc::not_supported - if the driver can only deliver
+   * messages through on_receive().
+   */
+  [[nodiscard]] result<receive_t> receive(std::span<message_t> p_messages)
+  {
+    return driver_receive(p_messages);
+  }
+
   virtual ~can() = default;
 
 private:
@@ -223,5 +436,371 @@ private:
   virtual status driver_bus_on() = 0;
   virtual result<send_t> driver_send(const message_t& p_message) = 0;
   virtual void driver_on_receive(hal::callback<handler> p_handler) = 0;
+  virtual result<send_t> driver_send(std::span<const message_t> p_messages)
+  {
+    for (const auto& message : p_messages) {
+      HAL_CHECK(driver_send(message));
+    }
+    return send_t{};
+  }
+  virtual status driver_attach_transmit_queue(std::span<message_t> p_buffer)
+  {
+    (void)p_buffer;
+    return hal::new_error(std::errc::not_supported);
+  }
+  virtual status driver_filter(std::span<const filter_t> p_filters)
+  {
+    (void)p_filters;
+    return hal::new_error(std::errc::not_supported);
+  }
+  virtual status driver_attach_receive_queue(std::span<message_t> p_buffer)
+  {
+    (void)p_buffer;
+    return hal::new_error(std::errc::not_supported);
+  }
+  virtual result<receive_t> driver_receive(std::span<message_t> p_messages)
+  {
+    (void)p_messages;
+    return hal::new_error(std::errc::not_supported);
+  }
+};
+
+/**
+ * @brief Priority-ordered software transmit queue over caller storage
+ *
+ * Standard implementation for drivers backing attach_transmit_queue(): a
+ * binary heap over the attached buffer ordered by CAN ID, lower IDs first
+ * to match bus arbitration, so pop() always yields the frame that would win
+ * the bus. Frames sharing an ID pop in the order they were pushed, which
+ * multi-frame protocols layered on one ID (ISO-TP, J1939 TP) depend on.
+ * Push and pop are O(log n) with no allocation.
+ *
+ * While a message resides in the queue, its reserved bytes hold the FIFO
+ * sequence used as the equal-ID tiebreaker; pop() returns messages with
+ * the reserved bytes restored to zero, so the must-be-zero serialization
+ * rule holds for every message leaving the queue. Do not read messages out
+ * of the attached storage directly.
+ *
+ * The queue itself is not synchronized: drivers pushing from thread context
+ * and popping from the transmit-complete interrupt must guard both
+ * operations with a short critical section.
+ */
+class can_transmit_queue
+{
+public:
+  /**
+   * @brief Construct a queue over the supplied storage
+   *
+   * @param p_storage - backing storage for queued messages, must outlive
+   * the queue
+   */
+  explicit can_transmit_queue(std::span<can::message_t> p_storage)
+    : m_storage(p_storage)
+  {
+  }
+
+  /**
+   * @brief Enqueue a message by ID priority
+   *
+   * @param p_message - message to enqueue
+   * @return bool - false if the queue was full and the message was not
+   * enqueued
+   */
+  [[nodiscard]] bool push(const can::message_t& p_message)
+  {
+    if (m_size == m_storage.size()) {
+      return false;
+    }
+    size_t index = m_size++;
+    m_storage[index] = p_message;
+    set_sequence(m_storage[index], m_next_sequence++);
+    // Sift the new message up while it outranks its parent
+    while (index != 0) {
+      size_t parent = (index - 1) / 2;
+      if (!outranks(m_storage[index], m_storage[parent])) {
+        break;
+      }
+      std::swap(m_storage[parent], m_storage[index]);
+      index = parent;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Dequeue the highest priority (lowest ID) message
+   *
+   * @return std::optional<can::message_t> - the dequeued message, or
+   * std::nullopt when the queue is empty
+   */
+  [[nodiscard]] std::optional<can::message_t> pop()
+  {
+    if (m_size == 0) {
+      return std::nullopt;
+    }
+    can::message_t front = m_storage[0];
+    front.reserved = {};
+    m_size--;
+    m_storage[0] = m_storage[m_size];
+    // Sift the relocated message down below any higher priority children
+    size_t index = 0;
+    while (true) {
+      size_t smallest = index;
+      size_t left = (2 * index) + 1;
+      size_t right = (2 * index) + 2;
+      if (left < m_size && outranks(m_storage[left], m_storage[smallest])) {
+        smallest = left;
+      }
+      if (right < m_size && outranks(m_storage[right], m_storage[smallest])) {
+        smallest = right;
+      }
+      if (smallest == index) {
+        break;
+      }
+      std::swap(m_storage[index], m_storage[smallest]);
+      index = smallest;
+    }
+    return front;
+  }
+
+  /**
+   * @brief Number of messages currently queued
+   *
+   */
+  [[nodiscard]] size_t size() const
+  {
+    return m_size;
+  }
+
+  /**
+   * @brief True when no messages are queued
+   *
+   */
+  [[nodiscard]] bool empty() const
+  {
+    return m_size == 0;
+  }
+
+  /**
+   * @brief Maximum number of messages the storage can hold
+   *
+   */
+  [[nodiscard]] size_t capacity() const
+  {
+    return m_storage.size();
+  }
+
+private:
+  static void set_sequence(can::message_t& p_message, std::uint16_t p_sequence)
+  {
+    p_message.reserved[0] = static_cast<hal::byte>(p_sequence & 0xFF);
+    p_message.reserved[1] = static_cast<hal::byte>(p_sequence >> 8);
+  }
+
+  static std::uint16_t sequence_of(const can::message_t& p_message)
+  {
+    return static_cast<std::uint16_t>(
+      p_message.reserved[0] | (p_message.reserved[1] << 8));
+  }
+
+  // True when p_left must transmit before p_right: lower ID wins, and for
+  // equal IDs the earlier push wins. The sequence comparison is modular,
+  // which stays correct because the sequences inside the queue at any one
+  // time span at most its capacity.
+  static bool outranks(const can::message_t& p_left,
+                       const can::message_t& p_right)
+  {
+    if (p_left.id != p_right.id) {
+      return p_left.id < p_right.id;
+    }
+    return static_cast<std::int16_t>(sequence_of(p_left) -
+                                     sequence_of(p_right)) < 0;
+  }
+
+  std::span<can::message_t> m_storage;
+  size_t m_size = 0;
+  std::uint16_t m_next_sequence = 0;
+};
+
+/**
+ * @brief View a span of CAN messages as their raw serialized bytes
+ *
+ * message_t's fixed 16-byte layout makes this view suitable for writing
+ * message arrays directly to binary logs or streaming them over another
+ * transport without field-by-field packing.
+ *
+ * @param p_messages - messages to view as bytes
+ * @return std::span<const hal::byte> - byte view over the same storage
+ */
+[[nodiscard]] inline std::span<const hal::byte> message_bytes(
+  std::span<const can::message_t> p_messages)
+{
+  return { reinterpret_cast<const hal::byte*>(p_messages.data()),
+           p_messages.size_bytes() };
+}
+
+/**
+ * @brief View a span of CAN messages as writable raw bytes
+ *
+ * Allows message arrays to be reconstituted with a single bulk copy from a
+ * log or DMA buffer.
+ *
+ * @param p_messages - messages to view as bytes
+ * @return std::span<hal::byte> - mutable byte view over the same storage
+ */
+[[nodiscard]] inline std::span<hal::byte> message_bytes(
+  std::span<can::message_t> p_messages)
+{
+  return { reinterpret_cast<hal::byte*>(p_messages.data()),
+           p_messages.size_bytes() };
+}
+
+/**
+ * @brief CAN bit timing solved against a specific peripheral input clock
+ *
+ */
+struct can_bit_timing_t
+{
+  /**
+   * @brief Input clock divisor producing the time quantum clock
+   *
+   * One time quantum lasts `prescaler` input clock cycles.
+   */
+  std::uint32_t prescaler;
+  /**
+   * @brief Propagation Delay (1qt ... 8qt)
+   *
+   */
+  std::uint8_t propagation_delay;
+  /**
+   * @brief Length of Phase Segment 1 (1qt ... 8qt)
+   *
+   */
+  std::uint8_t phase_segment1;
+  /**
+   * @brief Length of Phase Segment 2 (1qt ... 8qt)
+   *
+   */
+  std::uint8_t phase_segment2;
+  /**
+   * @brief Synchronization jump width (1qt ... 4qt)
+   *
+   */
+  std::uint8_t synchronization_jump_width;
+
+  /**
+   * @brief Express this timing as a can::settings for the given baud rate
+   *
+   * @param p_baud_rate - the baud rate this timing was solved for
+   * @return can::settings - settings with the solved segment values
+   */
+  [[nodiscard]] constexpr can::settings to_settings(hertz p_baud_rate) const
+  {
+    return can::settings{
+      .baud_rate = p_baud_rate,
+      .propagation_delay = propagation_delay,
+      .phase_segment1 = phase_segment1,
+      .phase_segment2 = phase_segment2,
+      .synchronization_jump_width = synchronization_jump_width,
+    };
+  }
 };
+
+/**
+ * @brief Solve CAN bit timing segments for a baud rate at compile time
+ *
+ * Searches for the segment layout with the most time quanta per bit that
+ * divides the input clock down to the requested baud rate exactly, then
+ * places the sample point as close as possible to p_sample_point. The
+ * function is constexpr so drivers with a fixed input clock can evaluate it
+ * at compile time and load precomputed register values:
+ *
+ *     static constexpr auto timing =
+ *       hal::calculate_can_bit_timing(8.0_MHz, 100.0_kHz).value();
+ *
+ * Evaluating at runtime is also valid for input clocks only known at
+ * startup.
+ *
+ * @param p_input_clock - frequency of the clock driving the CAN bit timing
+ * unit
+ * @param p_baud_rate - target bus baud rate
+ * @param p_sample_point - desired sample point as a proportion of the bit
+ * period, defaults to 87.5% per CANopen and DeviceNet recommendations
+ * @return std::optional<can_bit_timing_t> - the solved bit timing, or
+ * std::nullopt if no combination of prescaler and segments reaches the baud
+ * rate exactly. Solutions always satisfy the can::settings constraint that
+ * the synchronization jump width is strictly smaller than both phase
+ * segments, which requires at least 6 quanta per bit; an exact division
+ * that only fits in fewer quanta is rejected.
+ */
+[[nodiscard]] constexpr std::optional<can_bit_timing_t>
+calculate_can_bit_timing(hertz p_input_clock,
+                         hertz p_baud_rate,
+                         float p_sample_point = 0.875f) noexcept
+{
+  // Segment bounds from can::settings: sync is fixed at 1qt, propagation
+  // delay and both phase segments span 1qt to 8qt each. The jump width is
+  // at least 1qt and must be strictly smaller than both phase segments, so
+  // each phase segment needs at least 2qt.
+  constexpr std::uint32_t minimum_quanta = 1 + 1 + 2 + 2;
+  constexpr std::uint32_t maximum_quanta = 1 + 8 + 8 + 8;
+
+  if (p_input_clock <= 0.0f || p_baud_rate <= 0.0f ||
+      p_sample_point <= 0.0f || p_sample_point >= 1.0f) {
+    return std::nullopt;
+  }
+
+  // Prefer more quanta per bit: a finer quantum gives a sample point closer
+  // to the requested proportion and a larger resynchronization range.
+  for (std::uint32_t quanta = maximum_quanta; quanta >= minimum_quanta;
+       quanta--) {
+    float ideal_prescaler =
+      p_input_clock / (p_baud_rate * static_cast<float>(quanta));
+    auto prescaler = static_cast<std::uint32_t>(ideal_prescaler + 0.5f);
+    if (prescaler < 1) {
+      continue;
+    }
+    float achieved_baud_rate =
+      p_input_clock / static_cast<float>(prescaler * quanta);
+    float error = achieved_baud_rate - p_baud_rate;
+    if (error > p_baud_rate * 1e-6f || error < p_baud_rate * -1e-6f) {
+      continue;
+    }
+
+    // Quanta before the sample point, including the sync segment. Clamped
+    // so sync + propagation delay + phase segment 1 fit their bounds and
+    // phase segment 2 stays within 2qt to 8qt.
+    std::uint32_t minimum_before_sample = std::max(quanta, 12U) - 8;
+    std::uint32_t maximum_before_sample = std::min(quanta - 2, 17U);
+    auto quanta_before_sample = static_cast<std::uint32_t>(
+      (static_cast<float>(quanta) * p_sample_point) + 0.5f);
+    quanta_before_sample = std::clamp(
+      quanta_before_sample, minimum_before_sample, maximum_before_sample);
+
+    std::uint32_t phase_segment2 = quanta - quanta_before_sample;
+
+    // Split the pre-sample quanta between propagation delay and phase
+    // segment 1, filling the propagation delay first but leaving phase
+    // segment 1 at least 2qt so the jump width can stay below it.
+    std::uint32_t pre_sample_segments = quanta_before_sample - 1;
+    std::uint32_t propagation_delay = std::min<std::uint32_t>(
+      pre_sample_segments - 2, 8);
+    std::uint32_t phase_segment1 = pre_sample_segments - propagation_delay;
+
+    // can::settings requires the jump width to be strictly smaller than
+    // both phase segments.
+    std::uint32_t synchronization_jump_width =
+      std::min({ std::uint32_t{ 4 }, phase_segment1 - 1, phase_segment2 - 1 });
+
+    return can_bit_timing_t{
+      .prescaler = prescaler,
+      .propagation_delay = static_cast<std::uint8_t>(propagation_delay),
+      .phase_segment1 = static_cast<std::uint8_t>(phase_segment1),
+      .phase_segment2 = static_cast<std::uint8_t>(phase_segment2),
+      .synchronization_jump_width =
+        static_cast<std::uint8_t>(synchronization_jump_width),
+    };
+  }
+
+  return std::nullopt;
+}
 }  // namespace hal
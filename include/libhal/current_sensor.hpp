@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
 #include "units.hpp"
 
 namespace hal {
@@ -33,6 +37,35 @@ public:
   {
     hal::ampere current = 0.0f;
   };
+
+  /**
+   * @brief Windowed statistics of a burst of current samples
+   *
+   */
+  struct statistics_t
+  {
+    /**
+     * @brief Smallest current observed in the window
+     *
+     */
+    hal::ampere min = 0.0f;
+    /**
+     * @brief Largest current observed in the window
+     *
+     */
+    hal::ampere max = 0.0f;
+    /**
+     * @brief Arithmetic mean of the window's samples
+     *
+     */
+    hal::ampere mean = 0.0f;
+    /**
+     * @brief Root mean square of the window's samples
+     *
+     */
+    hal::ampere rms = 0.0f;
+  };
+
   /**
    * @brief Reads the most up to date current from the sensor
    *
@@ -43,9 +76,58 @@ public:
     return driver_read();
   }
 
+  /**
+   * @brief Sample a window of current readings and return its statistics
+   *
+   * Use this for measurements that need high-rate sampling but only a
+   * summary — stall transient detection, ripple measurement, power
+   * accounting — where reading every sample over the bus would cost one
+   * transaction per sample. Implementations for monitoring chips with
+   * on-chip accumulation, such as windowed min/max registers or energy
+   * accumulators, should override the default implementation so the whole
+   * window costs a handful of bus reads at the device's native sample
+   * rate. The default implementation computes the statistics from
+   * p_sample_count calls of the single read() API, which reduces bus
+   * traffic only when the caller polls the summary less often than it
+   * would have polled raw samples.
+   *
+   * @param p_sample_count - number of samples in the window
+   * @return result<statistics_t> - min, max, mean and RMS of the window
+   * @throws std::errc::invalid_argument - if p_sample_count is zero.
+   */
+  [[nodiscard]] result<statistics_t> statistics(size_t p_sample_count)
+  {
+    return driver_statistics(p_sample_count);
+  }
+
   virtual ~current_sensor() = default;
 
 private:
   virtual hal::result<read_t> driver_read() = 0;
+  virtual hal::result<statistics_t> driver_statistics(size_t p_sample_count)
+  {
+    if (p_sample_count == 0) {
+      return hal::new_error(std::errc::invalid_argument);
+    }
+    auto first = HAL_CHECK(driver_read()).current;
+    auto minimum = first;
+    auto maximum = first;
+    auto sum = first;
+    auto sum_of_squares = first * first;
+    for (size_t index = 1; index < p_sample_count; index++) {
+      auto sample = HAL_CHECK(driver_read()).current;
+      minimum = std::min(minimum, sample);
+      maximum = std::max(maximum, sample);
+      sum += sample;
+      sum_of_squares += sample * sample;
+    }
+    auto count = static_cast<float>(p_sample_count);
+    return statistics_t{
+      .min = minimum,
+      .max = maximum,
+      .mean = sum / count,
+      .rms = std::sqrt(sum_of_squares / count),
+    };
+  }
 };
 }  // namespace hal
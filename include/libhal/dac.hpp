@@ -14,9 +14,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
+#include <span>
 
 #include "error.hpp"
+#include "functional.hpp"
+#include "units.hpp"
 
 namespace hal {
 /**
@@ -39,6 +43,49 @@ public:
   struct write_t
   {};
 
+  /**
+   * @brief Playback modes for waveform playback
+   *
+   */
+  enum class playback_mode : std::uint8_t
+  {
+    /**
+     * @brief Play the waveform once, then hold the final sample
+     *
+     */
+    one_shot = 0,
+    /**
+     * @brief Replay the waveform from the start each time it completes
+     *
+     */
+    circular,
+  };
+
+  /**
+   * @brief Handler invoked when the waveform buffer has been played out
+   *
+   * In one_shot mode the handler is invoked once when playback finishes. In
+   * circular mode it is invoked at the end of each pass over the buffer,
+   * which gives the application a chance to update the buffer contents for
+   * the next pass. Like interrupt pin handlers, this handler is typically
+   * invoked in interrupt context and must not block.
+   */
+  using playback_handler = void(void);
+
+  /**
+   * @brief Feedback from starting waveform playback.
+   *
+   */
+  struct playback_t
+  {
+    /**
+     * @brief The actual sample rate achieved by the driver
+     *
+     * May differ from the requested rate due to clock divider granularity.
+     */
+    hertz sample_rate;
+  };
+
   /**
    * @brief Set the output voltage of the DAC.
    *
@@ -66,9 +113,104 @@ public:
     return driver_write(clamped_percentage);
   }
 
+  /**
+   * @brief Set the output voltage of the DAC using a fixed point ratio
+   *
+   * Follows the same proportionality rules as the float overload with a
+   * hal::q31 ratio in place of the float, allowing FPU-less platforms to set
+   * the output voltage without any floating point arithmetic. Negative ratios
+   * are clamped to 0.0 so values passed to driver implementations are
+   * guaranteed to be between 0.0 and 1.0.
+   *
+   * Drivers that can compute their output register value from the raw fixed
+   * point value should override the fixed point virtual; the default
+   * implementation converts the ratio to float and uses the float path.
+   *
+   * @param p_percentage - a q31 ratio representing the proportion of the
+   * output voltage from the Vss to Vcc.
+   * @return result<write_t> - success or failure
+   */
+  [[nodiscard]] result<write_t> write(q31 p_percentage)
+  {
+    p_percentage.raw = std::max(p_percentage.raw, std::int32_t{ 0 });
+    return driver_write(p_percentage);
+  }
+
+  /**
+   * @brief Play a waveform out of the DAC without further application
+   * involvement
+   *
+   * The driver emits one sample from the buffer at the requested rate,
+   * typically by pacing a DMA channel from a hardware timer trigger, and
+   * invokes the handler each time the end of the buffer is reached.
+   * Playback continues until the buffer has been played once (one_shot),
+   * stop() is called, another playback is started or the driver is
+   * destroyed. The buffer must stay alive and unmodified for the duration
+   * of playback, except within the handler in circular mode.
+   *
+   * Each sample follows the same proportionality and clamping rules as the
+   * single write() API, except that clamping of out-of-range samples is
+   * driver-defined, so callers should supply samples within 0.0f to 1.0f.
+   *
+   * Calls to write() while playback is running are driver-defined and
+   * should be avoided.
+   *
+   * @param p_samples - waveform to play, as proportions from 0.0f to 1.0f
+   * @param p_sample_rate - requested rate at which to emit samples
+   * @param p_mode - whether to play the buffer once or repeatedly
+   * @param p_handler - invoked each time the end of the buffer is reached
+   * @return result<playback_t> - the achieved sample rate
+   * @throws std::errc::not_supported - if the driver cannot play samples in
+   * the background.
+   * @throws std::errc::invalid_argument - if the buffer is empty or the
+   * sample rate cannot be achieved.
+   */
+  [[nodiscard]] result<playback_t> play(std::span<const float> p_samples,
+                                        hertz p_sample_rate,
+                                        playback_mode p_mode,
+                                        hal::callback<playback_handler> p_handler)
+  {
+    return driver_play(p_samples, p_sample_rate, p_mode, p_handler);
+  }
+
+  /**
+   * @brief Stop a running waveform playback
+   *
+   * The output holds the most recently emitted sample. Does nothing if no
+   * playback is running.
+   *
+   * @return status - success or failure
+   * @throws std::errc::not_supported - if the driver cannot play samples in
+   * the background.
+   */
+  [[nodiscard]] status stop()
+  {
+    return driver_stop();
+  }
+
   virtual ~dac() = default;
 
 private:
   virtual result<write_t> driver_write(float p_percentage) = 0;
+  virtual result<write_t> driver_write(q31 p_percentage)
+  {
+    return driver_write(p_percentage.to_float());
+  }
+  virtual result<playback_t> driver_play(
+    std::span<const float> p_samples,
+    hertz p_sample_rate,
+    playback_mode p_mode,
+    hal::callback<playback_handler> p_handler)
+  {
+    (void)p_samples;
+    (void)p_sample_rate;
+    (void)p_mode;
+    (void)p_handler;
+    return hal::new_error(std::errc::not_supported);
+  }
+  virtual status driver_stop()
+  {
+    return hal::new_error(std::errc::not_supported);
+  }
 };
 }  // namespace hal
@@ -15,6 +15,7 @@
 #pragma once
 
 #include "error.hpp"
+#include "functional.hpp"
 #include "units.hpp"
 
 namespace hal {
@@ -93,6 +94,30 @@ public:
     meters distance;
   };
 
+  /**
+   * @brief Handler for continuous ranging sample delivery
+   *
+   * Invoked by the driver each time a new measurement completes. Like
+   * interrupt pin handlers, this handler is typically invoked in interrupt
+   * context and must not block.
+   */
+  using ranging_handler = void(read_t p_sample);
+
+  /**
+   * @brief Feedback from starting continuous ranging.
+   *
+   */
+  struct ranging_t
+  {
+    /**
+     * @brief The actual measurement rate achieved by the driver
+     *
+     * May differ from the requested rate due to the device's timing budget
+     * granularity.
+     */
+    hertz sample_rate;
+  };
+
   /**
    * @brief Read the current distance measured by the device
    *
@@ -103,9 +128,66 @@ public:
     return driver_read();
   }
 
+  /**
+   * @brief Continuously measure distance and deliver each new sample
+   *
+   * Many ranging devices, such as time of flight and ultrasonic sensors,
+   * take tens of milliseconds per measurement but free-run internally.
+   * Continuous ranging exposes that: the device measures at the requested
+   * rate and the driver invokes the handler with each new sample, removing
+   * both the dead blocking time of one-shot read() calls and the bus
+   * traffic of polling for readiness. Applications wanting a pollable
+   * latest-value instead of a push notification can store the sample into
+   * their own variable from the handler.
+   *
+   * Ranging continues until stop() is called, another ranging is started or
+   * the driver is destroyed. Calls to read() while continuous ranging is
+   * running are driver-defined and should be avoided.
+   *
+   * @param p_sample_rate - requested rate at which to take measurements
+   * @param p_handler - invoked with each newly completed measurement
+   * @return result<ranging_t> - the achieved measurement rate
+   * @throws std::errc::not_supported - if the driver cannot measure in the
+   * background.
+   * @throws std::errc::invalid_argument - if the sample rate cannot be
+   * achieved.
+   */
+  [[nodiscard]] result<ranging_t> start(
+    hertz p_sample_rate,
+    hal::callback<ranging_handler> p_handler)
+  {
+    return driver_start(p_sample_rate, p_handler);
+  }
+
+  /**
+   * @brief Stop a running continuous ranging
+   *
+   * Does nothing if continuous ranging is not running.
+   *
+   * @return status - success or failure
+   * @throws std::errc::not_supported - if the driver cannot measure in the
+   * background.
+   */
+  [[nodiscard]] status stop()
+  {
+    return driver_stop();
+  }
+
   virtual ~distance_sensor() = default;
 
 private:
   virtual result<read_t> driver_read() = 0;
+  virtual result<ranging_t> driver_start(
+    hertz p_sample_rate,
+    hal::callback<ranging_handler> p_handler)
+  {
+    (void)p_sample_rate;
+    (void)p_handler;
+    return hal::new_error(std::errc::not_supported);
+  }
+  virtual status driver_stop()
+  {
+    return hal::new_error(std::errc::not_supported);
+  }
 };
 }  // namespace hal
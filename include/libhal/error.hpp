@@ -14,23 +14,75 @@
 
 #pragma once
 
+#include <cstdint>
 #include <system_error>
+#include <type_traits>
+#include <utility>
 
+#include "error_trace.hpp"
+
+#if !defined(LIBHAL_LIGHTWEIGHT_ERROR)
 #include <boost/leaf/detail/all.hpp>
 
 #define HAL_CHECK BOOST_LEAF_CHECK
+#else
+#include "lightweight_error.hpp"
+
+#define HAL_CHECK LIBHAL_LIGHTWEIGHT_CHECK
+#endif
 
 namespace hal {
 
+#if !defined(LIBHAL_LIGHTWEIGHT_ERROR)
 template<typename T, T... value>
 using match = boost::leaf::match<T, value...>;
 template<class T>
 using result = boost::leaf::result<T>;
+#else
+template<typename T, T... value>
+using match = lightweight::match<T, value...>;
+template<class T>
+using result = lightweight::result<T>;
+#endif
 using status = result<void>;
 using error_handler = void(void);
 
+/**
+ * @brief Global hook invoked on every new_error
+ *
+ * When LIBHAL_ENABLE_ERROR_TRACE is defined project-wide, new_error also
+ * records a timestamped hal::trace entry. The hook is invoked in every
+ * configuration; applications that only want the trace simply leave it
+ * unset.
+ */
 inline error_handler* on_error_callback = nullptr;
 
+namespace detail {
+/**
+ * @brief Derive a trace site identifier from the items attached to an error
+ *
+ * A hal::trace::error_site item takes precedence, then the first std::errc
+ * item, then zero.
+ */
+template<class... Item>
+constexpr std::uint32_t error_site_of(const Item&... p_item)
+{
+  std::uint32_t site = 0;
+  [[maybe_unused]] auto capture = [&site](const auto& p_value) {
+    using item_t = std::decay_t<decltype(p_value)>;
+    if constexpr (std::is_same_v<item_t, trace::error_site>) {
+      site = p_value.id;
+    } else if constexpr (std::is_same_v<item_t, std::errc>) {
+      if (site == 0) {
+        site = static_cast<std::uint32_t>(p_value);
+      }
+    }
+  };
+  (capture(p_item), ...);
+  return site;
+}
+}  // namespace detail
+
 /**
  * @defgroup Error Error
  *
@@ -64,6 +116,7 @@ inline status success()
   return successful_status;
 }
 
+#if !defined(LIBHAL_LIGHTWEIGHT_ERROR)
 template<class TryBlock, class... H>
 [[nodiscard]] constexpr auto attempt(TryBlock&& p_try_block, H&&... p_handlers)
 {
@@ -80,12 +133,42 @@ template<class TryBlock, class... H>
 template<class... Item>
 [[nodiscard]] inline auto new_error(Item&&... p_item)
 {
+#if defined(LIBHAL_ENABLE_ERROR_TRACE)
+  trace::record(detail::error_site_of(p_item...));
+#endif
   if (on_error_callback) {
     on_error_callback();
   }
 
   return boost::leaf::new_error(std::forward<Item>(p_item)...);
 }
+#else
+template<class TryBlock, class... H>
+[[nodiscard]] constexpr auto attempt(TryBlock&& p_try_block, H&&... p_handlers)
+{
+  return lightweight::try_handle_some(p_try_block, p_handlers...);
+}
+
+template<class TryBlock, class... H>
+[[nodiscard]] constexpr auto attempt_all(TryBlock&& p_try_block,
+                                         H&&... p_handlers)
+{
+  return lightweight::try_handle_all(p_try_block, p_handlers...);
+}
+
+template<class... Item>
+[[nodiscard]] inline auto new_error(Item&&... p_item)
+{
+#if defined(LIBHAL_ENABLE_ERROR_TRACE)
+  trace::record(detail::error_site_of(p_item...));
+#endif
+  if (on_error_callback) {
+    on_error_callback();
+  }
+
+  return lightweight::new_error(std::forward<Item>(p_item)...);
+}
+#endif
 
 [[noreturn]] inline void halt()
 {
@@ -0,0 +1,187 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <span>
+
+/**
+ * @brief Number of entries held by the error trace ring
+ *
+ * Must be a power of two. Define this macro project-wide to resize the ring.
+ */
+#ifndef LIBHAL_ERROR_TRACE_SIZE
+#define LIBHAL_ERROR_TRACE_SIZE 32
+#endif
+
+namespace hal::trace {
+static_assert((LIBHAL_ERROR_TRACE_SIZE & (LIBHAL_ERROR_TRACE_SIZE - 1)) == 0,
+              "LIBHAL_ERROR_TRACE_SIZE must be a power of two");
+
+/**
+ * @brief Tags an error with an application-chosen site identifier
+ *
+ * Attach to an error as an additional item to identify which call site or
+ * driver raised it in the trace ring:
+ *
+ *     return hal::new_error(std::errc::io_error,
+ *                           hal::trace::error_site{ 0x1201 });
+ *
+ * Errors raised without a site tag are recorded under their std::errc value
+ * when one is present, and under site zero otherwise.
+ */
+struct error_site
+{
+  std::uint32_t id;
+};
+
+/**
+ * @brief One recorded error occurrence
+ *
+ */
+struct entry_t
+{
+  /**
+   * @brief Site identifier of the error, see error_site
+   *
+   */
+  std::uint32_t site;
+  /**
+   * @brief Steady clock tick count when the error was raised
+   *
+   * Zero until a tick source is registered with attach_tick_source().
+   */
+  std::uint64_t ticks;
+};
+
+/**
+ * @brief Function providing timestamps for trace entries
+ *
+ * Typically a thin wrapper over a global steady clock:
+ *
+ *     std::uint64_t trace_ticks()
+ *     {
+ *       return system_clock().uptime().ticks;
+ *     }
+ */
+using tick_source = std::uint64_t(void);
+
+/**
+ * @brief Access the registered tick source pointer
+ *
+ * @return tick_source*& - reference to the tick source pointer
+ */
+inline tick_source*& ticks()
+{
+  static tick_source* source = nullptr;
+  return source;
+}
+
+/**
+ * @brief Register a tick source for timestamping trace entries
+ *
+ * The source is called from record(), potentially in interrupt context, and
+ * must be safe to call there. Without a source, entries record zero ticks.
+ *
+ * @param p_source - function returning the current steady clock tick count
+ */
+inline void attach_tick_source(tick_source* p_source)
+{
+  ticks() = p_source;
+}
+
+/**
+ * @brief Access the trace ring storage
+ *
+ * @return std::array of entries, indexed modulo LIBHAL_ERROR_TRACE_SIZE
+ */
+inline std::array<entry_t, LIBHAL_ERROR_TRACE_SIZE>& ring()
+{
+  static std::array<entry_t, LIBHAL_ERROR_TRACE_SIZE> entries{};
+  return entries;
+}
+
+/**
+ * @brief Access the total count of recorded errors
+ *
+ * Monotonically increases for the lifetime of the program; the ring holds
+ * the most recent LIBHAL_ERROR_TRACE_SIZE of them.
+ *
+ * @return std::atomic<std::uint32_t>& - the running error count
+ */
+inline std::atomic<std::uint32_t>& recorded()
+{
+  static std::atomic<std::uint32_t> count{ 0 };
+  return count;
+}
+
+/**
+ * @brief Record an error occurrence into the trace ring
+ *
+ * Lock-free and safe to call from interrupt context: slot reservation is a
+ * single relaxed fetch_add, so concurrent recorders never block each other.
+ * When the ring is full the oldest entry is overwritten.
+ *
+ * @param p_site - site identifier to record
+ */
+inline void record(std::uint32_t p_site) noexcept
+{
+  std::uint64_t tick_count = 0;
+  auto* source = ticks();
+  if (source != nullptr) {
+    tick_count = source();
+  }
+  auto index = recorded().fetch_add(1, std::memory_order_relaxed);
+  ring()[index % LIBHAL_ERROR_TRACE_SIZE] = entry_t{
+    .site = p_site,
+    .ticks = tick_count,
+  };
+}
+
+/**
+ * @brief Copy the most recent trace entries into a buffer, oldest first
+ *
+ * Intended for post-mortem dumps: pass a buffer of
+ * LIBHAL_ERROR_TRACE_SIZE entries to retrieve everything the ring holds.
+ *
+ * @param p_buffer - destination for the copied entries
+ * @return std::span<entry_t> - the filled portion of p_buffer
+ */
+inline std::span<entry_t> dump(std::span<entry_t> p_buffer)
+{
+  std::uint32_t total = recorded().load(std::memory_order_relaxed);
+  std::uint32_t stored = std::min<std::uint32_t>(
+    total, LIBHAL_ERROR_TRACE_SIZE);
+  auto count = static_cast<std::uint32_t>(
+    std::min<size_t>(stored, p_buffer.size()));
+  std::uint32_t oldest = total - count;
+  for (std::uint32_t index = 0; index < count; index++) {
+    p_buffer[index] = ring()[(oldest + index) % LIBHAL_ERROR_TRACE_SIZE];
+  }
+  return p_buffer.first(count);
+}
+
+/**
+ * @brief Discard all recorded trace entries
+ *
+ */
+inline void reset()
+{
+  recorded().store(0, std::memory_order_relaxed);
+}
+}  // namespace hal::trace
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstdint>
+#include <utility>
 
 #include "third_party/inplace_function.hpp"
 #include <tl/function_ref.hpp>
@@ -67,4 +68,134 @@ using inplace_function = stdext::inplace_function<F, Capacity>;
  */
 template<typename F>
 using callback = inplace_function<F, sizeof(std::intptr_t) * 2>;
+
+/**
+ * @ingroup Functional
+ * @brief Callable binding a statically known handler at compile time
+ *
+ * Where a handler is known at compile time, static_callback removes the
+ * dispatch indirection that callback and function_ref pay at each
+ * invocation: the target is a template argument, so calls resolve directly
+ * and inline. A member function binding carries only the object pointer and
+ * a free function binding carries no state at all.
+ *
+ *     class logger
+ *     {
+ *     public:
+ *       void log(const can::message_t& p_message);
+ *     };
+ *
+ *     logger can_logger;
+ *     hal::static_callback<&logger::log> handler(can_logger);
+ *     handler(message);          // direct, inlinable call
+ *     bus.on_receive(handler);   // still converts to hal::callback
+ *
+ * Conversion to the interface callback types works because static_callback
+ * is itself a small callable object; handler installation keeps its usual
+ * signature while call sites that hold the static_callback directly skip
+ * the indirection entirely.
+ *
+ * @tparam target - pointer to the member or free function to bind
+ */
+template<auto target>
+class static_callback;
+
+/**
+ * @ingroup Functional
+ * @brief static_callback binding a non-const member function
+ *
+ * @tparam T - class providing the member function
+ * @tparam R - the member function's return type
+ * @tparam Args - the member function's argument types
+ */
+template<typename T, typename R, typename... Args, R (T::*target)(Args...)>
+class static_callback<target>
+{
+public:
+  /**
+   * @brief Bind the member function to an object
+   *
+   * @param p_object - object to invoke the member function on. Must outlive
+   * this callback and anything it is converted to.
+   */
+  constexpr explicit static_callback(T& p_object)
+    : m_object(&p_object)
+  {
+  }
+
+  constexpr R operator()(Args... p_args) const
+  {
+    return (m_object->*target)(std::forward<Args>(p_args)...);
+  }
+
+private:
+  T* m_object;
+};
+
+/**
+ * @ingroup Functional
+ * @brief static_callback binding a const member function
+ *
+ * @tparam T - class providing the member function
+ * @tparam R - the member function's return type
+ * @tparam Args - the member function's argument types
+ */
+template<typename T, typename R, typename... Args,
+         R (T::*target)(Args...) const>
+class static_callback<target>
+{
+public:
+  /**
+   * @brief Bind the member function to an object
+   *
+   * @param p_object - object to invoke the member function on. Must outlive
+   * this callback and anything it is converted to.
+   */
+  constexpr explicit static_callback(const T& p_object)
+    : m_object(&p_object)
+  {
+  }
+
+  constexpr R operator()(Args... p_args) const
+  {
+    return (m_object->*target)(std::forward<Args>(p_args)...);
+  }
+
+private:
+  const T* m_object;
+};
+
+/**
+ * @ingroup Functional
+ * @brief static_callback binding a free function
+ *
+ * Stateless: default constructible and convertible to a plain function
+ * pointer for installation into interrupt vector tables.
+ *
+ * @tparam R - the function's return type
+ * @tparam Args - the function's argument types
+ */
+template<typename R, typename... Args, R (*target)(Args...)>
+class static_callback<target>
+{
+public:
+  /**
+   * @brief Plain function pointer matching the bound function's signature
+   *
+   */
+  using function_pointer = R (*)(Args...);
+
+  constexpr static_callback() = default;
+
+  constexpr R operator()(Args... p_args) const
+  {
+    return target(std::forward<Args>(p_args)...);
+  }
+
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  constexpr operator function_pointer() const
+  {
+    return target;
+  }
+};
 }  // namespace hal
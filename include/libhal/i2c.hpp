@@ -18,6 +18,7 @@
 
 #include "error.hpp"
 #include "functional.hpp"
+#include "instrumentation.hpp"
 #include "timeout.hpp"
 #include "units.hpp"
 
@@ -56,6 +57,78 @@ public:
   struct transaction_t
   {};
 
+  /**
+   * @brief Description of a single transaction within a batch of transactions
+   *
+   * The rules for the data_out and data_in spans follow the rules of the
+   * single `transaction()` API. A record with both spans empty performs no
+   * work.
+   */
+  struct transaction_record
+  {
+    /**
+     * @brief 7-bit address of the device to communicate with
+     *
+     * Follows the same 10-bit address rules as the single `transaction()` API.
+     */
+    hal::byte address;
+    /**
+     * @brief Data to be written to the addressed device
+     *
+     * Set to an empty span to skip writing.
+     */
+    std::span<const hal::byte> data_out;
+    /**
+     * @brief Buffer to store data read from the addressed device
+     *
+     * Set to an empty span to skip reading.
+     */
+    std::span<hal::byte> data_in;
+  };
+
+  /**
+   * @brief Condition that ends a repeated polling transaction
+   *
+   * The predicate is satisfied when the byte at `index` of the read buffer,
+   * masked with `mask`, equals `value`.
+   */
+  struct poll_predicate
+  {
+    /**
+     * @brief Bits of the tested byte that participate in the comparison
+     *
+     */
+    hal::byte mask;
+    /**
+     * @brief Value the masked byte must equal for polling to end
+     *
+     */
+    hal::byte value;
+    /**
+     * @brief Position within the read buffer of the byte to test
+     *
+     */
+    size_t index = 0;
+  };
+
+  /**
+   * @brief Feedback from a repeated polling transaction
+   *
+   */
+  struct poll_t
+  {
+    /**
+     * @brief The unmasked value of the tested byte when polling ended
+     *
+     */
+    hal::byte value;
+    /**
+     * @brief Number of transactions issued, including the one that matched
+     *
+     */
+    size_t transaction_count;
+  };
+
   /**
    * @brief Configure i2c to match the settings supplied
    *
@@ -123,7 +196,139 @@ public:
     std::span<hal::byte> p_data_in,
     hal::function_ref<hal::timeout_function> p_timeout)
   {
-    return driver_transaction(p_address, p_data_out, p_data_in, p_timeout);
+    instrument::scope telemetry(instrument::tag::i2c_transaction);
+    auto response =
+      driver_transaction(p_address, p_data_out, p_data_in, p_timeout);
+    telemetry.complete(bool{ response },
+                       p_data_out.size() + p_data_in.size());
+    return response;
+  }
+
+  /**
+   * @brief Owning resumable handle to an in-flight asynchronous transaction
+   *
+   * Created by `transaction_async()`. Call the worker repeatedly to poll the
+   * state of the transfer. Follows the rules of `hal::work_function`, meaning
+   * that once a terminal state is returned the worker must not be called
+   * again with the expectation of additional work being performed.
+   */
+  using transaction_worker =
+    hal::inplace_function<hal::work_function, sizeof(std::intptr_t) * 8>;
+
+  /**
+   * @brief Start an i2c transaction without blocking until it has finished
+   *
+   * Follows the same span rules and error semantics as the blocking
+   * `transaction()` API. The returned worker reports
+   * `work_state::in_progress` until the transfer has finished, at which point
+   * it returns `work_state::finished`, or an error if the transfer failed.
+   * Implementations with interrupt or DMA driven transfers should override
+   * the default implementation such that the bus transfer proceeds in the
+   * background and each call to the worker simply samples its progress.
+   *
+   * The default implementation defers the entire blocking transaction to the
+   * first call of the returned worker, which means the first poll performs
+   * the whole transfer and returns a terminal state.
+   *
+   * The spans passed to this function must stay alive and unmodified until
+   * the worker has reached a terminal state or has been destroyed.
+   *
+   * @param p_address 7-bit address of the device you want to communicate
+   * with. Follows the same 10-bit address rules as the blocking API.
+   * @param p_data_out data to be written to the addressed device. Set to an
+   * empty span in order to skip writing.
+   * @param p_data_in buffer to store read data from the addressed device. Set
+   * to an empty span in order to skip reading.
+   * @return result<transaction_worker> - worker to poll for completion, or an
+   * error if the transfer could not be started.
+   */
+  [[nodiscard]] result<transaction_worker> transaction_async(
+    hal::byte p_address,
+    std::span<const hal::byte> p_data_out,
+    std::span<hal::byte> p_data_in)
+  {
+    return driver_transaction_async(p_address, p_data_out, p_data_in);
+  }
+
+  /**
+   * @brief Perform a batch of i2c transactions back-to-back. This function
+   * will block until every transaction in the batch is finished.
+   *
+   * Each record in the batch follows the same rules as the single transaction
+   * API. Implementations with hardware support, such as DMA descriptor chains,
+   * are encouraged to override the default implementation and chain the
+   * transactions together with repeated-start conditions between them,
+   * emitting a stop condition only after the final transaction. The default
+   * implementation simply performs each transaction in order, one at a time,
+   * which provides the same bus traffic minus the repeated-starts between
+   * records.
+   *
+   * If any transaction within the batch fails, the batch is abandoned at that
+   * record and the error is returned to the caller.
+   *
+   * @param p_transactions - list of transactions to perform in order
+   * @param p_timeout - callable which notifies the i2c driver that it has run
+   * out of time to perform the batch of transactions and must stop and return
+   * control to the caller.
+   * @return result<transaction_t> - success or failure
+   * @throws std::errc::io_error - same meaning as the single transaction API.
+   * @throws std::errc::no_such_device_or_address - same meaning as the single
+   * transaction API, reported for the record that was not acknowledged.
+   * @throws std::errc::timed_out if the batch exceeded its time allotment
+   * indicated by p_timeout.
+   */
+  [[nodiscard]] result<transaction_t> transaction(
+    std::span<const transaction_record> p_transactions,
+    hal::function_ref<hal::timeout_function> p_timeout)
+  {
+    return driver_transaction(p_transactions, p_timeout);
+  }
+
+  /**
+   * @brief Repeat one transaction back-to-back until a read byte matches
+   *
+   * Use this to wait on device status flags, such as a data-ready or busy
+   * bit, in place of calling `transaction()` in a loop: the transaction is
+   * specified once and re-issued below the virtual boundary until the
+   * predicate is satisfied or the timeout expires. Implementations with
+   * hardware transaction repeat should override the default implementation
+   * so successive transfers are chained without re-arming the peripheral;
+   * others benefit from skipping the per-iteration call overhead alone.
+   *
+   * The address and span rules follow the single `transaction()` API, except
+   * that p_data_in must be large enough to contain the byte selected by
+   * `poll_predicate::index`.
+   *
+   * @param p_address 7-bit address of the device you want to communicate
+   * with. Follows the same 10-bit address rules as the blocking API.
+   * @param p_data_out data to be written to the addressed device before each
+   * read, typically the status register index. Set to an empty span in order
+   * to skip writing.
+   * @param p_data_in buffer to store read data from the addressed device.
+   * Holds the bytes of the final transaction when this function returns.
+   * @param p_predicate condition on the read-back data that ends polling
+   * @param p_timeout callable which notifies the i2c driver that it has run
+   * out of time to perform the transaction and must stop and return control
+   * to the caller.
+   * @return result<poll_t> - the matching byte value and the number of
+   * transactions issued
+   * @throws std::errc::invalid_argument - if p_data_in does not contain the
+   * byte selected by the predicate.
+   * @throws std::errc::timed_out - if the predicate was not satisfied within
+   * the time allotment indicated by p_timeout.
+   * @throws std::errc::io_error - same meaning as the single transaction API.
+   * @throws std::errc::no_such_device_or_address - same meaning as the
+   * single transaction API.
+   */
+  [[nodiscard]] result<poll_t> poll(
+    hal::byte p_address,
+    std::span<const hal::byte> p_data_out,
+    std::span<hal::byte> p_data_in,
+    const poll_predicate& p_predicate,
+    hal::function_ref<hal::timeout_function> p_timeout)
+  {
+    return driver_poll(p_address, p_data_out, p_data_in, p_predicate,
+                       p_timeout);
   }
 
   virtual ~i2c() = default;
@@ -135,5 +340,60 @@ private:
     std::span<const hal::byte> p_data_out,
     std::span<hal::byte> p_data_in,
     hal::function_ref<hal::timeout_function> p_timeout) = 0;
+  virtual result<transaction_worker> driver_transaction_async(
+    hal::byte p_address,
+    std::span<const hal::byte> p_data_out,
+    std::span<hal::byte> p_data_in)
+  {
+    return transaction_worker(
+      [this, p_address, p_data_out, p_data_in,
+       state = work_state::in_progress]() mutable -> result<work_state> {
+        if (state != work_state::in_progress) {
+          return state;
+        }
+        auto transaction_result = driver_transaction(
+          p_address, p_data_out, p_data_in, hal::never_timeout());
+        if (!transaction_result) {
+          state = work_state::failed;
+          return transaction_result.error();
+        }
+        state = work_state::finished;
+        return state;
+      });
+  }
+  virtual result<poll_t> driver_poll(
+    hal::byte p_address,
+    std::span<const hal::byte> p_data_out,
+    std::span<hal::byte> p_data_in,
+    const poll_predicate& p_predicate,
+    hal::function_ref<hal::timeout_function> p_timeout)
+  {
+    if (p_predicate.index >= p_data_in.size()) {
+      return hal::new_error(std::errc::invalid_argument);
+    }
+    size_t transaction_count = 0;
+    while (true) {
+      HAL_CHECK(
+        driver_transaction(p_address, p_data_out, p_data_in, p_timeout));
+      transaction_count++;
+      auto value = p_data_in[p_predicate.index];
+      if ((value & p_predicate.mask) == p_predicate.value) {
+        return poll_t{ .value = value,
+                       .transaction_count = transaction_count };
+      }
+      HAL_CHECK(p_timeout());
+    }
+  }
+  virtual result<transaction_t> driver_transaction(
+    std::span<const transaction_record> p_transactions,
+    hal::function_ref<hal::timeout_function> p_timeout)
+  {
+    transaction_t response{};
+    for (const auto& record : p_transactions) {
+      response = HAL_CHECK(driver_transaction(
+        record.address, record.data_out, record.data_in, p_timeout));
+    }
+    return response;
+  }
 };
 }  // namespace hal
@@ -0,0 +1,197 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "error.hpp"
+#include "units.hpp"
+
+namespace hal {
+/**
+ * @brief Timer input capture hardware abstraction interface
+ *
+ * Use this interface for timer peripherals that can latch a free-running
+ * counter value at the moment a signal edge arrives on a capture pin. The
+ * latch happens in silicon, so edge timestamps carry no interrupt latency
+ * jitter and edges can be recorded at rates far beyond what an
+ * `hal::interrupt_pin` callback can service — a tachometer that previously
+ * cost thousands of interrupts per second becomes a periodic drain of the
+ * capture buffer.
+ *
+ * Timestamps are expressed in ticks of the capture counter, whose rate is
+ * reported by frequency(). The counter wraps around at an
+ * implementation-defined width, so intervals must be computed with
+ * wraparound-safe subtraction.
+ */
+class input_capture
+{
+public:
+  /**
+   * @brief The signal edge that latches a timestamp
+   *
+   */
+  enum class trigger_edge
+  {
+    /**
+     * @brief Capture when the signal transitions from HIGH to LOW
+     *
+     */
+    falling = 0,
+    /**
+     * @brief Capture when the signal transitions from LOW to HIGH
+     *
+     */
+    rising = 1,
+    /**
+     * @brief Capture on any signal transition
+     *
+     */
+    both = 2,
+  };
+
+  /**
+   * @brief Generic settings for input capture units
+   *
+   */
+  struct settings
+  {
+    /**
+     * @brief The edge that latches the capture counter
+     *
+     */
+    trigger_edge trigger = trigger_edge::rising;
+  };
+
+  /**
+   * @brief Feedback from reading the capture counter frequency
+   *
+   */
+  struct frequency_t
+  {
+    /**
+     * @brief Rate at which the capture counter increments
+     *
+     */
+    hertz frequency;
+  };
+
+  /**
+   * @brief Result from draining captured edge timestamps
+   *
+   */
+  struct capture_t
+  {
+    /**
+     * @brief The filled portion of the buffer passed to capture()
+     *
+     * The size of this span indicates the number of edges captured. The
+     * address points to the start of the buffer passed into the capture()
+     * function. Timestamps are ordered oldest first.
+     */
+    std::span<std::uint64_t> timestamps;
+    /**
+     * @brief Number of edges lost to capture overrun since the last drain
+     *
+     * Edges arriving while the hardware capture storage is full are counted
+     * here rather than silently dropped. Not all hardware can detect
+     * overruns; drivers that cannot will always report zero.
+     */
+    size_t lost;
+  };
+
+  /**
+   * @brief Result from measuring the signal period
+   *
+   */
+  struct period_t
+  {
+    /**
+     * @brief Capture counter ticks between the two most recent edges
+     *
+     * Divide the frequency reported by frequency() by this value to compute
+     * the signal frequency in hertz.
+     */
+    std::uint64_t ticks;
+  };
+
+  /**
+   * @brief Configure the input capture unit to match the settings supplied
+   *
+   * @param p_settings - settings to apply to the input capture unit
+   * @return status - success or failure
+   * @throws std::errc::invalid_argument if the settings could not be
+   * achieved.
+   */
+  [[nodiscard]] status configure(const settings& p_settings)
+  {
+    return driver_configure(p_settings);
+  }
+
+  /**
+   * @brief Read the rate at which the capture counter increments
+   *
+   * @return result<frequency_t> - the capture counter frequency
+   */
+  [[nodiscard]] result<frequency_t> frequency()
+  {
+    return driver_frequency();
+  }
+
+  /**
+   * @brief Copy timestamps of edges captured since the last drain
+   *
+   * The buffer is filled either to its end or until no captured edges
+   * remain, whichever comes first. Edges continue to be captured by
+   * hardware between calls, so the application only needs to call this
+   * often enough to keep the hardware capture storage from overrunning.
+   *
+   * @param p_timestamps - buffer to fill with captured edge timestamps
+   * @return result<capture_t> - the filled portion of the buffer and the
+   * number of edges lost to overrun
+   */
+  [[nodiscard]] result<capture_t> capture(std::span<std::uint64_t> p_timestamps)
+  {
+    return driver_capture(p_timestamps);
+  }
+
+  /**
+   * @brief Measure the interval between the two most recent captured edges
+   *
+   * Use this for frequency and duty cycle measurement when the individual
+   * timestamps are not needed: one call per control tick replaces draining
+   * and differencing the capture buffer. The measurement does not remove
+   * edges from the capture buffer.
+   *
+   * @return result<period_t> - the interval in capture counter ticks
+   * @throws std::errc::resource_unavailable_try_again - if fewer than two
+   * edges have been captured since configuration.
+   */
+  [[nodiscard]] result<period_t> period()
+  {
+    return driver_period();
+  }
+
+  virtual ~input_capture() = default;
+
+private:
+  virtual status driver_configure(const settings& p_settings) = 0;
+  virtual result<frequency_t> driver_frequency() = 0;
+  virtual result<capture_t> driver_capture(
+    std::span<std::uint64_t> p_timestamps) = 0;
+  virtual result<period_t> driver_period() = 0;
+};
+}  // namespace hal
@@ -32,6 +32,20 @@ public:
   {
     /// Pull resistor for an input pin
     pin_resistor resistor = pin_resistor::pull_up;
+
+    /**
+     * @brief Minimum duration the pin must hold a level before a level
+     * change is reported
+     *
+     * Use to reject switch bounce and line glitches. Zero disables
+     * filtering. Implementations should use the GPIO block's hardware
+     * input filter where one exists, rounding the duration up to the
+     * nearest filter period the hardware supports; when no hardware filter
+     * exists, implementations may debounce in software by timestamping
+     * level changes and suppressing reads shorter than this duration, or
+     * throw std::errc::invalid_argument if they provide neither.
+     */
+    time_duration minimum_stable_duration = time_duration::zero();
   };
 
   /// Input pin level reading structure
@@ -0,0 +1,195 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "error.hpp"
+#include "functional.hpp"
+#include "units.hpp"
+
+namespace hal {
+/**
+ * @brief Digital input port hardware abstraction.
+ *
+ * Use this to read a group of up to 32 input pins as a single unit, such as
+ * a parallel data bus or a logic capture front end, where reading the pins
+ * one at a time with individual hal::input_pin objects costs one virtual
+ * call per pin and skews the reads across time. Implementations observe all
+ * pins with a single port register load, so every bit of the returned value
+ * reflects the same instant.
+ *
+ * The mapping from bit positions to physical pins is defined by the
+ * implementation. Bit 0 is the least significant pin of the port.
+ *
+ */
+class input_port
+{
+public:
+  /// Generic settings for input ports, applied to every pin in the port
+  struct settings
+  {
+    /// Pull resistor for the pins
+    pin_resistor resistor = pin_resistor::pull_up;
+  };
+
+  /// Port value reading structure
+  struct value_t
+  {
+    /// Current state of each pin of the port. Bits outside the width of the
+    /// port are zero.
+    uint32_t state;
+  };
+
+  /**
+   * @brief A port state observed at a point in time
+   *
+   */
+  struct snapshot_t
+  {
+    /**
+     * @brief Counter ticks at the moment the port was sampled
+     *
+     * The tick frequency is reported by `stream_t::timestamp_frequency` when
+     * the stream is started.
+     */
+    std::uint64_t timestamp;
+    /**
+     * @brief State of each pin of the port at that moment, following the
+     * same rules as value_t::state
+     */
+    uint32_t state;
+  };
+
+  /**
+   * @brief Handler for streamed snapshot delivery
+   *
+   * The span passed to the handler is the half of the streaming ring buffer
+   * that has just been filled and is safe to process until the same half is
+   * reported again. Like interrupt pin handlers, this handler is typically
+   * invoked in interrupt context and must not block.
+   */
+  using stream_handler = void(std::span<const snapshot_t> p_snapshots);
+
+  /**
+   * @brief Feedback from starting a snapshot stream.
+   *
+   */
+  struct stream_t
+  {
+    /**
+     * @brief The actual snapshot rate achieved by the driver
+     *
+     * May differ from the requested rate due to clock divider granularity.
+     */
+    hertz sample_rate;
+    /**
+     * @brief Rate of the counter used to timestamp each snapshot
+     *
+     */
+    hertz timestamp_frequency;
+  };
+
+  /**
+   * @brief Configure the input port to match the settings supplied
+   *
+   * The settings are applied to every pin belonging to the port.
+   *
+   * @param p_settings - settings to apply to the input port
+   * @return status - success or failure
+   * @throws std::errc::invalid_argument if the settings could not be achieved.
+   */
+  [[nodiscard]] status configure(const settings& p_settings)
+  {
+    return driver_configure(p_settings);
+  }
+
+  /**
+   * @brief Read the current state of every pin in the port
+   *
+   * @return result<value_t> - the current state of each pin of the port
+   */
+  [[nodiscard]] result<value_t> read()
+  {
+    return driver_read();
+  }
+
+  /**
+   * @brief Continuously sample the port into a ring buffer at a fixed rate
+   * without further application involvement
+   *
+   * The driver samples the port at the requested rate, typically via a timer
+   * paced DMA transfer, storing a timestamped snapshot per sample and
+   * invoking the handler each time half of the ring buffer has been filled,
+   * alternating between the lower and upper halves. Sampling continues until
+   * stop() is called, another stream is started or the driver is destroyed.
+   * The buffer must stay alive for that entire duration.
+   *
+   * @param p_buffer - ring buffer for the driver to fill. Must hold an even
+   * number of snapshots so it can be split into two halves.
+   * @param p_sample_rate - requested rate at which to sample the port
+   * @param p_handler - invoked each time half of the ring buffer is ready
+   * @return result<stream_t> - the achieved sample rate and the timestamp
+   * counter frequency
+   * @throws std::errc::not_supported - if the driver cannot sample the port
+   * in the background.
+   * @throws std::errc::invalid_argument - if the buffer length is odd or too
+   * small, or the sample rate cannot be achieved.
+   */
+  [[nodiscard]] result<stream_t> stream(std::span<snapshot_t> p_buffer,
+                                        hertz p_sample_rate,
+                                        hal::callback<stream_handler> p_handler)
+  {
+    return driver_stream(p_buffer, p_sample_rate, p_handler);
+  }
+
+  /**
+   * @brief Stop a running snapshot stream
+   *
+   * Stops the free-running sampling started by stream(). After this call
+   * returns the handler will no longer be invoked and the ring buffer may be
+   * released. Calling this without a running stream has no effect.
+   *
+   * @return status - success or failure
+   * @throws std::errc::not_supported - if the driver cannot sample the port
+   * in the background.
+   */
+  [[nodiscard]] status stop()
+  {
+    return driver_stop();
+  }
+
+  virtual ~input_port() = default;
+
+private:
+  virtual status driver_configure(const settings& p_settings) = 0;
+  virtual result<value_t> driver_read() = 0;
+  virtual result<stream_t> driver_stream(
+    std::span<snapshot_t> p_buffer,
+    hertz p_sample_rate,
+    hal::callback<stream_handler> p_handler)
+  {
+    (void)p_buffer;
+    (void)p_sample_rate;
+    (void)p_handler;
+    return hal::new_error(std::errc::not_supported);
+  }
+  virtual status driver_stop()
+  {
+    return hal::new_error(std::errc::not_supported);
+  }
+};
+}  // namespace hal
@@ -0,0 +1,212 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "steady_clock.hpp"
+
+namespace hal::instrument {
+/**
+ * @brief Telemetry counters gathered at an interface's public shim
+ *
+ * Counters accumulate across every driver implementing the instrumented
+ * interface, giving a per-bus-type view of traffic without wrapping drivers
+ * in counting decorators.
+ */
+struct counters_t
+{
+  /**
+   * @brief Number of calls made through the shim
+   *
+   */
+  std::uint32_t calls = 0;
+  /**
+   * @brief Number of calls that returned an error
+   *
+   */
+  std::uint32_t errors = 0;
+  /**
+   * @brief Total bytes moved by successful calls
+   *
+   */
+  std::uint64_t bytes = 0;
+  /**
+   * @brief Longest observed call duration in steady clock ticks
+   *
+   * Remains zero until a clock is supplied with attach_clock().
+   */
+  std::uint64_t worst_case_ticks = 0;
+};
+
+/**
+ * @brief Identifies which interface shim a counter set belongs to
+ *
+ */
+enum class tag : std::uint8_t
+{
+  i2c_transaction = 0,
+  serial_write,
+  can_send,
+  spi_transfer,
+};
+
+/// Number of instrumented interface shims
+constexpr size_t tag_count = 4;
+
+#if defined(LIBHAL_ENABLE_INSTRUMENTATION)
+/**
+ * @brief Access the registry of per-interface counters
+ *
+ * @return std::array<counters_t, tag_count>& - counters indexed by tag
+ */
+inline std::array<counters_t, tag_count>& registry()
+{
+  static std::array<counters_t, tag_count> counters{};
+  return counters;
+}
+
+/**
+ * @brief Access the steady clock used for latency measurement
+ *
+ * @return steady_clock*& - reference to the registered clock pointer
+ */
+inline steady_clock*& latency_clock()
+{
+  static steady_clock* clock = nullptr;
+  return clock;
+}
+
+/**
+ * @brief Supply a steady clock for worst case latency measurement
+ *
+ * Without a clock, calls, errors and bytes are still counted but
+ * worst_case_ticks stays zero. The clock must outlive all instrumented
+ * calls.
+ *
+ * @param p_clock - clock to timestamp instrumented calls with
+ */
+inline void attach_clock(steady_clock& p_clock)
+{
+  latency_clock() = &p_clock;
+}
+
+/**
+ * @brief Read a snapshot of an interface's counters
+ *
+ * @param p_tag - which interface shim to read
+ * @return counters_t - copy of the current counter values
+ */
+[[nodiscard]] inline counters_t read(tag p_tag)
+{
+  return registry()[static_cast<size_t>(p_tag)];
+}
+
+/**
+ * @brief Zero every counter in the registry
+ *
+ */
+inline void reset()
+{
+  registry().fill(counters_t{});
+}
+
+/**
+ * @brief Measures a single pass through an interface shim
+ *
+ * Construct before invoking the driver virtual and call complete() with the
+ * call's success state afterwards. When LIBHAL_ENABLE_INSTRUMENTATION is
+ * not defined this class is empty and every member is a constexpr no-op, so
+ * the shims compile exactly as they did without instrumentation.
+ */
+class scope
+{
+public:
+  /**
+   * @brief Begin measuring an instrumented call
+   *
+   * @param p_tag - which interface shim is being measured
+   */
+  explicit scope(tag p_tag)
+    : m_counters(&registry()[static_cast<size_t>(p_tag)])
+  {
+    auto* clock = latency_clock();
+    if (clock) {
+      m_start_ticks = clock->uptime().ticks;
+      m_timed = true;
+    }
+  }
+
+  /**
+   * @brief Record the outcome of the instrumented call
+   *
+   * @param p_success - true if the call returned without error
+   * @param p_bytes - bytes actually moved by the call
+   */
+  void complete(bool p_success, size_t p_bytes)
+  {
+    m_counters->calls++;
+    if (p_success) {
+      m_counters->bytes += p_bytes;
+    } else {
+      m_counters->errors++;
+    }
+    if (m_timed) {
+      auto elapsed = latency_clock()->uptime().ticks - m_start_ticks;
+      if (elapsed > m_counters->worst_case_ticks) {
+        m_counters->worst_case_ticks = elapsed;
+      }
+    }
+  }
+
+private:
+  counters_t* m_counters;
+  std::uint64_t m_start_ticks = 0;
+  bool m_timed = false;
+};
+#else
+inline void attach_clock(steady_clock& p_clock)
+{
+  (void)p_clock;
+}
+
+[[nodiscard]] inline counters_t read(tag p_tag)
+{
+  (void)p_tag;
+  return counters_t{};
+}
+
+inline void reset()
+{
+}
+
+class scope
+{
+public:
+  constexpr explicit scope(tag p_tag)
+  {
+    (void)p_tag;
+  }
+
+  constexpr void complete(bool p_success, size_t p_bytes)
+  {
+    (void)p_success;
+    (void)p_bytes;
+  }
+};
+#endif  // LIBHAL_ENABLE_INSTRUMENTATION
+}  // namespace hal::instrument
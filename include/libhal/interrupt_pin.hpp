@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "error.hpp"
 #include "functional.hpp"
 #include "units.hpp"
@@ -80,6 +82,23 @@ public:
      *
      */
     trigger_edge trigger = trigger_edge::rising;
+
+    /**
+     * @brief Minimum duration the pin must hold a level before an edge
+     * triggers the callback
+     *
+     * Use to reject switch bounce: a mechanical switch generating a burst
+     * of spurious edges produces a single callback when this duration
+     * exceeds the bounce time. Zero disables filtering. Implementations
+     * should use the GPIO block's hardware glitch filter where one exists,
+     * rounding the duration up to the nearest filter period the hardware
+     * supports, so rejected edges never raise an interrupt; when no
+     * hardware filter exists, implementations may fall back to suppressing
+     * callbacks in the interrupt handler for edges arriving within this
+     * duration of the previous accepted edge, or throw
+     * std::errc::invalid_argument if they provide neither.
+     */
+    time_duration minimum_stable_duration = time_duration::zero();
   };
 
   /**
@@ -90,6 +109,32 @@ public:
    */
   using handler = void(bool p_state);
 
+  /**
+   * @brief Interrupt pin handler with a hardware captured edge timestamp
+   *
+   * param p_state - if true state of the pin when the interrupt was triggered
+   * was HIGH, otherwise LOW
+   * param p_timestamp - counter ticks captured by hardware at the moment of
+   * the edge. The tick frequency is reported by `capture_t::frequency` when
+   * the handler is installed. The counter wraps around at an
+   * implementation-defined width, so durations must be computed with
+   * wraparound-safe subtraction.
+   */
+  using timestamped_handler = void(bool p_state, std::uint64_t p_timestamp);
+
+  /**
+   * @brief Feedback from installing a timestamped trigger callback
+   *
+   */
+  struct capture_t
+  {
+    /**
+     * @brief Frequency of the counter used to timestamp each edge
+     *
+     */
+    hertz frequency;
+  };
+
   /**
    * @brief Configure the interrupt pin to match the settings supplied
    *
@@ -114,10 +159,40 @@ public:
     return driver_on_trigger(p_callback);
   }
 
+  /**
+   * @brief Set a callback receiving a hardware captured timestamp of the edge
+   *
+   * Use this in place of the plain on_trigger() overload to measure pulse
+   * widths and edge-to-edge intervals without the jitter of reading a clock
+   * from software inside the callback. Implementations backed by timer input
+   * capture hardware should latch the counter value at the moment of the
+   * edge and pass it to the callback unmodified. Installing this callback
+   * replaces any callback installed by either on_trigger() overload.
+   *
+   * Any state transitions before this function is called are lost.
+   *
+   * @param p_callback - function to execute when the trigger condition
+   * occurs, receiving the pin state and the captured timestamp.
+   * @return result<capture_t> - the frequency of the timestamp counter
+   * @throws std::errc::not_supported - if the pin has no edge capture
+   * hardware available.
+   */
+  [[nodiscard]] result<capture_t> on_trigger(
+    hal::callback<timestamped_handler> p_callback)
+  {
+    return driver_on_trigger(p_callback);
+  }
+
   virtual ~interrupt_pin() = default;
 
 private:
   virtual status driver_configure(const settings& p_settings) = 0;
   virtual void driver_on_trigger(hal::callback<handler> p_callback) = 0;
+  virtual result<capture_t> driver_on_trigger(
+    hal::callback<timestamped_handler> p_callback)
+  {
+    (void)p_callback;
+    return hal::new_error(std::errc::not_supported);
+  }
 };
 }  // namespace hal
@@ -0,0 +1,241 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @defgroup Latency Latency
+ * @file latency.hpp
+ * @brief Fixed-memory latency and jitter measurement harness for
+ * callback-driven interfaces.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "steady_clock.hpp"
+#include "units.hpp"
+
+namespace hal {
+/**
+ * @ingroup Latency
+ * @brief Accumulates a latency distribution in fixed memory
+ *
+ * Records 64-bit tick intervals into min, max, count, total and a
+ * power-of-two bucketed histogram: an interval of N ticks lands in bucket
+ * std::bit_width(N), so bucket B counts intervals in [2^(B-1), 2^B).
+ * Log-spaced buckets keep tail outliers — the measurements that bound a
+ * control architecture — visible without the memory cost of linear
+ * resolution. Recording is a handful of integer operations with no
+ * allocation, cheap enough for interrupt context.
+ *
+ * @tparam BucketCount - number of histogram buckets. Intervals wider than
+ * 2^(BucketCount-1) ticks saturate into the last bucket.
+ */
+template<size_t BucketCount = 24>
+class latency_histogram
+{
+public:
+  static_assert(BucketCount >= 2,
+                "latency_histogram requires at least two buckets");
+
+  /**
+   * @brief Summary statistics of the recorded intervals
+   *
+   */
+  struct summary_t
+  {
+    /**
+     * @brief Number of intervals recorded
+     *
+     */
+    std::uint32_t count;
+    /**
+     * @brief Smallest recorded interval in ticks, zero when count is zero
+     *
+     */
+    std::uint64_t min;
+    /**
+     * @brief Largest recorded interval in ticks
+     *
+     */
+    std::uint64_t max;
+    /**
+     * @brief Sum of every recorded interval in ticks
+     *
+     * Divide by count for the mean.
+     */
+    std::uint64_t total;
+  };
+
+  /**
+   * @brief Record one interval into the distribution
+   *
+   * @param p_ticks - the interval in steady clock ticks
+   */
+  void record(std::uint64_t p_ticks)
+  {
+    m_count++;
+    m_total += p_ticks;
+    m_min = std::min(m_min, p_ticks);
+    m_max = std::max(m_max, p_ticks);
+    auto bucket = static_cast<size_t>(std::bit_width(p_ticks));
+    m_buckets[std::min(bucket, BucketCount - 1)]++;
+  }
+
+  /**
+   * @brief Read the summary statistics of the recorded intervals
+   *
+   * @return summary_t - count, min, max and total
+   */
+  [[nodiscard]] summary_t summary() const
+  {
+    return summary_t{
+      .count = m_count,
+      .min = m_count == 0 ? 0 : m_min,
+      .max = m_max,
+      .total = m_total,
+    };
+  }
+
+  /**
+   * @brief Read the histogram buckets
+   *
+   * @return const std::array<std::uint32_t, BucketCount>& - interval counts
+   * where bucket B holds intervals in [2^(B-1), 2^B) ticks
+   */
+  [[nodiscard]] const std::array<std::uint32_t, BucketCount>& buckets() const
+  {
+    return m_buckets;
+  }
+
+  /**
+   * @brief Discard every recorded interval
+   *
+   */
+  void reset()
+  {
+    *this = latency_histogram{};
+  }
+
+private:
+  std::array<std::uint32_t, BucketCount> m_buckets{};
+  std::uint32_t m_count = 0;
+  std::uint64_t m_min = std::numeric_limits<std::uint64_t>::max();
+  std::uint64_t m_max = 0;
+  std::uint64_t m_total = 0;
+};
+
+/**
+ * @ingroup Latency
+ * @brief Measures event-to-callback latency against a steady clock
+ *
+ * Pairs two timestamps: the driver or test harness calls event() at the
+ * moment the hardware event is observed (interrupt entry, message
+ * reception), and the application calls callback() at the top of the
+ * callback servicing that event. The elapsed ticks between the two are
+ * accumulated into a latency_histogram, making dispatch latency and its
+ * jitter measurable for `can::on_receive`, `interrupt_pin::on_trigger`,
+ * `timer::schedule` and similar callback paths, both against mock drivers
+ * in unit tests and against real hardware.
+ *
+ * Each event() overwrites the previous pending timestamp, so when callbacks
+ * cannot keep up only the latency of the most recent event is measured.
+ * callback() without a pending event records nothing.
+ *
+ * @tparam BucketCount - forwarded to the underlying latency_histogram
+ */
+template<size_t BucketCount = 24>
+class latency_recorder
+{
+public:
+  /**
+   * @brief Construct a recorder against a clock
+   *
+   * @param p_clock - steady clock both timestamps are taken from. Must
+   * outlive this object.
+   */
+  explicit latency_recorder(hal::steady_clock& p_clock)
+    : m_clock(&p_clock)
+  {
+  }
+
+  /**
+   * @brief Timestamp the hardware event this recorder measures
+   *
+   */
+  void event()
+  {
+    event(m_clock->uptime().ticks);
+  }
+
+  /**
+   * @brief Record an externally captured event timestamp
+   *
+   * Use this overload when the driver already holds a hardware captured
+   * timestamp of the event, such as from `interrupt_pin`'s timestamped
+   * trigger callback, removing the software timestamping cost from the
+   * measured path.
+   *
+   * @param p_ticks - event time in ticks of the recorder's clock
+   */
+  void event(std::uint64_t p_ticks)
+  {
+    m_event_ticks = p_ticks;
+    m_event_pending = true;
+  }
+
+  /**
+   * @brief Timestamp callback entry and accumulate the elapsed latency
+   *
+   */
+  void callback()
+  {
+    if (!m_event_pending) {
+      return;
+    }
+    m_event_pending = false;
+    m_histogram.record(m_clock->uptime().ticks - m_event_ticks);
+  }
+
+  /**
+   * @brief Access the accumulated latency distribution
+   *
+   * @return const latency_histogram<BucketCount>& - the distribution
+   */
+  [[nodiscard]] const latency_histogram<BucketCount>& histogram() const
+  {
+    return m_histogram;
+  }
+
+  /**
+   * @brief Discard the accumulated distribution and any pending event
+   *
+   */
+  void reset()
+  {
+    m_histogram.reset();
+    m_event_pending = false;
+  }
+
+private:
+  hal::steady_clock* m_clock;
+  latency_histogram<BucketCount> m_histogram{};
+  std::uint64_t m_event_ticks = 0;
+  bool m_event_pending = false;
+};
+}  // namespace hal
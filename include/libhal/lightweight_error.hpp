@@ -0,0 +1,383 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @defgroup LightweightError Lightweight Error
+ * @file lightweight_error.hpp
+ * @brief Slim error policy selected by defining LIBHAL_LIGHTWEIGHT_ERROR.
+ *
+ * The default error policy of this library is built on boost.leaf, which
+ * provides rich error diagnostics at the cost of thread-local error slot
+ * machinery on every error path and a measurable code size footprint. For
+ * release builds of constrained applications where the error paths in
+ * practice cannot fail, or where only the error code matters, this file
+ * provides an `std::expected`-like replacement that carries a single
+ * `std::errc` value in a register and nothing else.
+ *
+ * Define LIBHAL_LIGHTWEIGHT_ERROR project-wide (it must be defined
+ * identically in every translation unit) to swap `hal::result`,
+ * `hal::attempt`, `hal::new_error` and `HAL_CHECK` over to this policy.
+ *
+ * Differences from the default policy:
+ *
+ * - Only an optional `std::errc` value passed to `hal::new_error()` is
+ *   recorded. All other error payload items are silently discarded.
+ * - Handlers passed to `hal::attempt()`/`hal::attempt_all()` can take no
+ *   arguments, a `std::errc`, or a `hal::match<std::errc, ...>`. Handlers
+ *   requiring any other payload type never match.
+ *
+ * This file is not intended to be included directly. Include
+ * libhal/error.hpp instead.
+ */
+#pragma once
+
+#include <optional>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace hal::lightweight {
+/**
+ * @ingroup LightweightError
+ * @brief Token representing a raised error, carrying only its error code
+ *
+ */
+struct error_id
+{
+  std::errc code{};
+};
+
+/**
+ * @ingroup LightweightError
+ * @brief Record an error, capturing a std::errc item if one is supplied
+ *
+ * @param p_item - error payload items. Only a `std::errc` is retained.
+ * @return error_id - token convertible into any result type
+ */
+template<class... Item>
+[[nodiscard]] constexpr error_id new_error(Item&&... p_item)
+{
+  error_id id{};
+  (
+    [&id](auto&& p_value) {
+      if constexpr (std::is_same_v<std::decay_t<decltype(p_value)>,
+                                   std::errc>) {
+        id.code = p_value;
+      }
+    }(std::forward<Item>(p_item)),
+    ...);
+  return id;
+}
+
+/**
+ * @ingroup LightweightError
+ * @brief Handler argument matching a set of std::errc values
+ *
+ * Mirrors the shape of `boost::leaf::match` for the error code payload.
+ *
+ * @tparam E - payload type, must be std::errc under this policy
+ * @tparam V - values that cause this handler to be selected
+ */
+template<class E, auto... V>
+struct match
+{
+  static_assert(std::is_same_v<E, std::errc>,
+                "The lightweight error policy only records std::errc. "
+                "Handlers matching other payload types cannot be used.");
+  /**
+   * @brief The matched error code
+   *
+   */
+  E matched;
+};
+
+/**
+ * @ingroup LightweightError
+ * @brief Slim result type carrying either a value or a std::errc
+ *
+ * @tparam T - type of the contained value
+ */
+template<class T>
+class [[nodiscard]] result
+{
+public:
+  using value_type = T;
+
+  constexpr result(T p_value)
+    : m_value(std::move(p_value))
+  {
+  }
+  constexpr result(error_id p_error)
+    : m_error(p_error)
+  {
+  }
+  template<class U>
+    requires(std::is_convertible_v<U, T> && !std::is_same_v<std::decay_t<U>, T>)
+  constexpr result(U&& p_value)
+    : m_value(std::forward<U>(p_value))
+  {
+  }
+
+  constexpr explicit operator bool() const
+  {
+    return m_value.has_value();
+  }
+  constexpr T& value() &
+  {
+    return *m_value;
+  }
+  constexpr const T& value() const&
+  {
+    return *m_value;
+  }
+  constexpr T&& value() &&
+  {
+    return std::move(*m_value);
+  }
+  constexpr error_id error() const
+  {
+    return m_error;
+  }
+
+private:
+  std::optional<T> m_value{};
+  error_id m_error{};
+};
+
+/**
+ * @ingroup LightweightError
+ * @brief Slim result specialization for operations returning no value
+ *
+ */
+template<>
+class [[nodiscard]] result<void>
+{
+public:
+  using value_type = void;
+
+  constexpr result() = default;
+  constexpr result(error_id p_error)
+    : m_error(p_error)
+    , m_failed(true)
+  {
+  }
+
+  constexpr explicit operator bool() const
+  {
+    return !m_failed;
+  }
+  constexpr void value() const {}
+  constexpr error_id error() const
+  {
+    return m_error;
+  }
+
+private:
+  error_id m_error{};
+  bool m_failed = false;
+};
+
+namespace detail {
+template<class T>
+struct is_match : std::false_type
+{};
+template<class E, auto... V>
+struct is_match<match<E, V...>> : std::true_type
+{};
+
+template<class H>
+struct handler_traits : handler_traits<decltype(&H::operator())>
+{};
+template<class C, class R, class... Args>
+struct handler_traits<R (C::*)(Args...) const>
+{
+  using args = std::tuple<std::decay_t<Args>...>;
+};
+template<class C, class R, class... Args>
+struct handler_traits<R (C::*)(Args...)>
+{
+  using args = std::tuple<std::decay_t<Args>...>;
+};
+
+template<class Arg>
+constexpr bool arg_convertible = is_match<Arg>::value ||
+                                 std::is_same_v<Arg, std::errc> ||
+                                 std::is_same_v<Arg, error_id>;
+
+// Handlers whose arguments cannot all be produced from a std::errc never
+// match under this policy, and must not be instantiated against one either
+template<class H>
+constexpr bool handler_compatible = []<class... Arg>(std::tuple<Arg...>*) {
+  return (arg_convertible<Arg> && ...);
+}(static_cast<typename handler_traits<H>::args*>(nullptr));
+
+template<class Arg>
+constexpr bool arg_matches(std::errc p_code)
+{
+  if constexpr (is_match<Arg>::value) {
+    return []<class E, auto... V>(match<E, V...>*, std::errc p_inner_code) {
+      return ((p_inner_code == static_cast<std::errc>(V)) || ...);
+    }(static_cast<Arg*>(nullptr), p_code);
+  } else {
+    static_assert(std::is_same_v<Arg, std::errc> ||
+                  std::is_same_v<Arg, error_id>);
+    return true;
+  }
+}
+
+template<class Arg>
+constexpr Arg make_arg(std::errc p_code)
+{
+  if constexpr (is_match<Arg>::value) {
+    return Arg{ p_code };
+  } else if constexpr (std::is_same_v<Arg, error_id>) {
+    return error_id{ p_code };
+  } else {
+    return p_code;
+  }
+}
+
+template<class H>
+constexpr bool handler_matches(std::errc p_code)
+{
+  using args = typename handler_traits<H>::args;
+  return []<class... Arg>(std::tuple<Arg...>*,
+                          [[maybe_unused]] std::errc p_inner_code) {
+    return (arg_matches<Arg>(p_inner_code) && ...);
+  }(static_cast<args*>(nullptr), p_code);
+}
+
+template<class H>
+constexpr decltype(auto) invoke_handler(H&& p_handler, std::errc p_code)
+{
+  using args = typename handler_traits<std::decay_t<H>>::args;
+  return [&p_handler]<class... Arg>(std::tuple<Arg...>*,
+                                    [[maybe_unused]] std::errc p_inner) {
+    return p_handler(make_arg<Arg>(p_inner)...);
+  }(static_cast<args*>(nullptr), p_code);
+}
+}  // namespace detail
+
+/**
+ * @ingroup LightweightError
+ * @brief Slim analog of boost::leaf::try_handle_some
+ *
+ * Runs the try block and, on failure, the first handler whose arguments
+ * match the recorded error code. If no handler matches, the error is
+ * propagated to the caller.
+ */
+template<class TryBlock, class... H>
+[[nodiscard]] constexpr auto try_handle_some(TryBlock&& p_try_block,
+                                             H&&... p_handlers)
+{
+  using result_type = std::invoke_result_t<TryBlock>;
+  result_type outcome = p_try_block();
+  if (outcome) {
+    return outcome;
+  }
+  auto code = outcome.error().code;
+  bool handled = false;
+  (
+    [&](auto&& p_handler) {
+      if constexpr (detail::handler_compatible<std::decay_t<H>>) {
+        if (!handled && detail::handler_matches<std::decay_t<H>>(code)) {
+          handled = true;
+          outcome = detail::invoke_handler(p_handler, code);
+        }
+      } else {
+        (void)p_handler;
+      }
+    }(p_handlers),
+    ...);
+  return outcome;
+}
+
+/**
+ * @ingroup LightweightError
+ * @brief Slim analog of boost::leaf::try_handle_all
+ *
+ * Runs the try block and, on failure, the first handler whose arguments
+ * match the recorded error code. Supply a handler taking no arguments as the
+ * catch-all; if no handler matches, the failure is swallowed and a default
+ * constructed value is returned.
+ */
+template<class TryBlock, class... H>
+constexpr auto try_handle_all(TryBlock&& p_try_block, H&&... p_handlers)
+{
+  using result_type = std::invoke_result_t<TryBlock>;
+  using value_type = typename result_type::value_type;
+  result_type outcome = p_try_block();
+  if constexpr (std::is_void_v<value_type>) {
+    if (outcome) {
+      return;
+    }
+    auto code = outcome.error().code;
+    bool handled = false;
+    (
+      [&](auto&& p_handler) {
+        if constexpr (detail::handler_compatible<std::decay_t<H>>) {
+          if (!handled && detail::handler_matches<std::decay_t<H>>(code)) {
+            handled = true;
+            detail::invoke_handler(p_handler, code);
+          }
+        } else {
+          (void)p_handler;
+        }
+      }(p_handlers),
+      ...);
+  } else {
+    if (outcome) {
+      return std::move(outcome).value();
+    }
+    auto code = outcome.error().code;
+    std::optional<value_type> value{};
+    (
+      [&](auto&& p_handler) {
+        if constexpr (detail::handler_compatible<std::decay_t<H>>) {
+          if (!value && detail::handler_matches<std::decay_t<H>>(code)) {
+            value = detail::invoke_handler(p_handler, code);
+          }
+        } else {
+          (void)p_handler;
+        }
+      }(p_handlers),
+      ...);
+    if (!value) {
+      value = value_type{};
+    }
+    return std::move(*value);
+  }
+}
+}  // namespace hal::lightweight
+
+#if defined(__GNUC__) || defined(__clang__)
+#define LIBHAL_LIGHTWEIGHT_CHECK(expr)                                         \
+  ({                                                                           \
+    auto&& libhal_lightweight_result = (expr);                                 \
+    if (!libhal_lightweight_result) {                                          \
+      return libhal_lightweight_result.error();                                \
+    }                                                                          \
+    std::move(libhal_lightweight_result).value();                              \
+  })
+#else
+// Without statement expressions the check can only be used as a statement,
+// discarding the contained value, which mirrors the boost.leaf fallback.
+#define LIBHAL_LIGHTWEIGHT_CHECK(expr)                                         \
+  do {                                                                         \
+    auto&& libhal_lightweight_result = (expr);                                 \
+    if (!libhal_lightweight_result) {                                          \
+      return libhal_lightweight_result.error();                                \
+    }                                                                          \
+  } while (false)
+#endif
@@ -0,0 +1,203 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @defgroup Lockfree Lockfree
+ * @file lockfree.hpp
+ * @brief Lock-free single-writer/single-reader primitives for ISR to main
+ * loop data handoff.
+ *
+ * Both primitives assume exactly one writing context and one reading
+ * context, the libhal callback model's natural shape: the driver callback
+ * (interrupt context) writes, the main loop reads. Synchronization uses
+ * acquire/release atomics and fences only — no critical sections, so no
+ * interrupts are ever blocked and the writer never waits. On single-core
+ * Cortex-M these orderings compile to plain loads and stores with compiler
+ * reordering barriers, since an interrupt and the code it preempts always
+ * observe each other in program order; on multi-core parts the same code
+ * remains correct through the hardware barriers the atomics emit.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace hal {
+/**
+ * @ingroup Lockfree
+ * @brief Wait-free "latest value" cell from one writer to one reader
+ *
+ * Stores the most recent value of a sample that the reader only ever wants
+ * the newest of — a sensor reading, a received CAN frame, a decoded
+ * setpoint. The writer always completes in a bounded handful of stores and
+ * never observes the reader; write() is safe to call from interrupt
+ * context at any rate. The reader validates a sequence counter around its
+ * copy and retries if a write overlapped, which on a single core can only
+ * happen when the write interrupted the read mid-copy.
+ *
+ * @tparam T - value type, must be trivially copyable
+ */
+template<class T>
+class latest_value
+{
+public:
+  static_assert(std::is_trivially_copyable_v<T>,
+                "latest_value requires a trivially copyable type");
+
+  /**
+   * @brief Publish a new value, replacing the previous one
+   *
+   * Must only be called from the single writing context.
+   *
+   * @param p_value - value to publish
+   */
+  void write(const T& p_value)
+  {
+    auto sequence = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_value = p_value;
+    std::atomic_thread_fence(std::memory_order_release);
+    m_sequence.store(sequence + 2, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Copy out the most recently published value
+   *
+   * Must only be called from the single reading context. Retries while a
+   * write is in progress or overlapped the copy.
+   *
+   * @return std::optional<T> - the latest value, or std::nullopt if no
+   * value has been published yet
+   */
+  [[nodiscard]] std::optional<T> read() const
+  {
+    while (true) {
+      auto before = m_sequence.load(std::memory_order_acquire);
+      if (before == 0) {
+        return std::nullopt;
+      }
+      if (before & 1) {
+        continue;
+      }
+      T copy = m_value;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      auto after = m_sequence.load(std::memory_order_relaxed);
+      if (before == after) {
+        return copy;
+      }
+    }
+  }
+
+private:
+  T m_value{};
+  std::atomic<std::uint32_t> m_sequence{ 0 };
+};
+
+/**
+ * @ingroup Lockfree
+ * @brief Fixed-capacity wait-free queue from one writer to one reader
+ *
+ * Use this when every produced element matters — received frames, captured
+ * edges — rather than only the newest. The producer and consumer each own
+ * one index and only read the other's, so neither operation loops, blocks
+ * or disables interrupts: push() and pop() are a bounded handful of
+ * operations in both contexts.
+ *
+ * @tparam T - element type, must be trivially copyable
+ * @tparam Capacity - number of elements the ring holds, must be a power of
+ * two
+ */
+template<class T, size_t Capacity>
+class spsc_ring
+{
+public:
+  static_assert(std::is_trivially_copyable_v<T>,
+                "spsc_ring requires a trivially copyable type");
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                "spsc_ring capacity must be a power of two");
+
+  /// Number of elements the ring can hold
+  static constexpr size_t capacity = Capacity;
+
+  /**
+   * @brief Append an element to the ring
+   *
+   * Must only be called from the single producing context.
+   *
+   * @param p_value - element to append
+   * @return bool - false if the ring was full and the element was dropped
+   */
+  [[nodiscard]] bool push(const T& p_value)
+  {
+    auto tail = m_tail.load(std::memory_order_relaxed);
+    auto head = m_head.load(std::memory_order_acquire);
+    if (tail - head == Capacity) {
+      return false;
+    }
+    m_buffer[tail & index_mask] = p_value;
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Remove and return the oldest element
+   *
+   * Must only be called from the single consuming context.
+   *
+   * @return std::optional<T> - the oldest element, or std::nullopt if the
+   * ring is empty
+   */
+  [[nodiscard]] std::optional<T> pop()
+  {
+    auto head = m_head.load(std::memory_order_relaxed);
+    auto tail = m_tail.load(std::memory_order_acquire);
+    if (tail == head) {
+      return std::nullopt;
+    }
+    T value = m_buffer[head & index_mask];
+    m_head.store(head + 1, std::memory_order_release);
+    return value;
+  }
+
+  /**
+   * @brief Number of elements currently in the ring
+   *
+   * An estimate when called concurrently with push or pop: never larger
+   * than the true count from the consumer's view, never smaller from the
+   * producer's.
+   */
+  [[nodiscard]] size_t size() const
+  {
+    return m_tail.load(std::memory_order_acquire) -
+           m_head.load(std::memory_order_acquire);
+  }
+
+  /// True when the ring holds no elements
+  [[nodiscard]] bool empty() const
+  {
+    return size() == 0;
+  }
+
+private:
+  static constexpr std::uint32_t index_mask = Capacity - 1;
+
+  std::array<T, Capacity> m_buffer{};
+  std::atomic<std::uint32_t> m_head{ 0 };
+  std::atomic<std::uint32_t> m_tail{ 0 };
+};
+}  // namespace hal
@@ -14,8 +14,11 @@
 
 #pragma once
 
+#include <span>
+
 #include "error.hpp"
 #include "units.hpp"
+#include "vec3.hpp"
 
 namespace hal {
 /**
@@ -31,31 +34,30 @@ class magnetometer
 {
 public:
   /**
-   * @brief Result from reading the accelerometer.
+   * @brief Result from reading the magnetometer.
    *
+   * Magnetic field strength in each axis is measured in gauss (hal::gauss)
+   * relative to the device's reference frame. Shares the hal::vec3 layout
+   * with the other x/y/z sensor interfaces so fusion code can mix samples
+   * without layout conversions.
    */
-  struct read_t
-  {
-    /**
-     * @brief Magnetic field strength in the X axis, relative to the device's
-     * reference frame.
-     *
-     */
-    gauss x;
-
-    /**
-     * @brief Magnetic field strength in the Y axis, relative to the device's
-     * reference frame.
-     *
-     */
-    gauss y;
+  using read_t = vec3;
 
+  /**
+   * @brief Result from batch reading the magnetometer.
+   *
+   */
+  struct batch_t
+  {
     /**
-     * @brief Magnetic field strength in the Z axis, relative to the device's
-     * reference frame.
+     * @brief The filled portion of the sample buffer passed to read()
      *
+     * The size of this span indicates the number of samples read, which may
+     * be less than the size of the buffer if the device's FIFO held fewer
+     * samples. The address points to the start of the buffer passed into the
+     * read() function.
      */
-    gauss z;
+    std::span<read_t> data;
   };
 
   /**
@@ -68,9 +70,34 @@ public:
     return driver_read();
   }
 
+  /**
+   * @brief Read a batch of magnetic field strength samples from the device
+   *
+   * Use this in place of repeated calls to the single read() API when the
+   * device buffers samples in an on-chip FIFO. Implementations for such
+   * devices should override the default implementation and drain the FIFO in
+   * a single burst bus transfer, which costs one bus transaction for the
+   * whole batch rather than one per sample. The default implementation fills
+   * the buffer with repeated single reads.
+   *
+   * @param p_samples - buffer to fill with magnetic field strength samples
+   * @return result<batch_t> - the filled portion of the buffer
+   */
+  [[nodiscard]] result<batch_t> read(std::span<read_t> p_samples)
+  {
+    return driver_read(p_samples);
+  }
+
   virtual ~magnetometer() = default;
 
 private:
   virtual result<read_t> driver_read() = 0;
+  virtual result<batch_t> driver_read(std::span<read_t> p_samples)
+  {
+    for (auto& sample : p_samples) {
+      sample = HAL_CHECK(driver_read());
+    }
+    return batch_t{ .data = p_samples };
+  }
 };
 }  // namespace hal
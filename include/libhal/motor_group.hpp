@@ -0,0 +1,134 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include "error.hpp"
+#include "motor.hpp"
+
+namespace hal {
+/**
+ * @brief Hardware abstraction for synchronized updates of multiple motors
+ *
+ * The motor counterpart of hal::servo_group, following the same rules.
+ * Multi-channel motor controller chips can commit a batch of power commands
+ * in a single burst bus transaction so all channels update simultaneously.
+ * Applications whose motors are independent devices can use
+ * hal::independent_motor_group to program against the same batch model.
+ */
+class motor_group
+{
+public:
+  /**
+   * @brief A power command for a single motor within the group
+   *
+   */
+  struct command
+  {
+    /**
+     * @brief Which motor in the group to power
+     *
+     * Drivers that implement this interface must document how channel
+     * numbers map to their output channels.
+     */
+    size_t channel;
+    /**
+     * @brief Percentage of power to apply to the motor from -1.0f to +1.0f
+     *
+     * Follows the same rules as the single hal::motor power API.
+     */
+    float power;
+  };
+
+  /**
+   * @brief Feedback from committing a group update
+   *
+   * This structure is currently empty as no feedback has been determined for
+   * now. This structure may be expanded in the future.
+   */
+  struct update_t
+  {};
+
+  /**
+   * @brief Commit a batch of motor power commands as one update
+   *
+   * If any command within the batch fails, the behavior of the remaining
+   * commands is driver-defined: chips that commit the batch atomically will
+   * reject the whole batch, whereas per-channel fallbacks stop at the
+   * failing command.
+   *
+   * @param p_commands - list of power commands to commit together
+   * @return result<update_t> - success or failure
+   * @throws std::errc::invalid_argument - when a command's channel does not
+   * exist in the group. When this error occurs, the guaranteed behavior is
+   * that every motor in the group keeps its last set power.
+   */
+  [[nodiscard]] result<update_t> update(std::span<const command> p_commands)
+  {
+    return driver_update(p_commands);
+  }
+
+  virtual ~motor_group() = default;
+
+private:
+  virtual result<update_t> driver_update(
+    std::span<const command> p_commands) = 0;
+};
+
+/**
+ * @brief motor_group implementation over independent hal::motor objects
+ *
+ * Allows applications to program against the batch update model even when
+ * their motors are unrelated devices without shared-bus burst support. Each
+ * command is applied with its motor's single power API, one at a time, so
+ * there is no transaction saving, only API uniformity.
+ */
+class independent_motor_group : public motor_group
+{
+public:
+  /**
+   * @brief Construct the group over a list of motors
+   *
+   * @param p_motors - the motors making up the group, indexed by channel.
+   * The list and the motors within it must outlive this object.
+   */
+  explicit independent_motor_group(std::span<motor* const> p_motors)
+    : m_motors(p_motors)
+  {
+  }
+
+  ~independent_motor_group() override = default;
+
+private:
+  result<update_t> driver_update(std::span<const command> p_commands) override
+  {
+    // Validate every channel before applying power, so a bad channel late
+    // in the batch cannot leave earlier motors already driven
+    for (const auto& entry : p_commands) {
+      if (entry.channel >= m_motors.size()) {
+        return hal::new_error(std::errc::invalid_argument);
+      }
+    }
+    for (const auto& entry : p_commands) {
+      HAL_CHECK(m_motors[entry.channel]->power(entry.power));
+    }
+    return update_t{};
+  }
+
+  std::span<motor* const> m_motors;
+};
+}  // namespace hal
@@ -0,0 +1,123 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "error.hpp"
+#include "units.hpp"
+
+namespace hal {
+/**
+ * @brief Digital output port hardware abstraction.
+ *
+ * Use this to drive a group of up to 32 output pins as a single unit, such as
+ * a parallel data bus, where updating the pins one at a time with individual
+ * hal::output_pin objects would cost one read-modify-write of the port
+ * register per pin. Implementations commit all requested bits with a single
+ * port register store.
+ *
+ * The mapping from bit positions to physical pins is defined by the
+ * implementation. Bit 0 is the least significant pin of the port.
+ *
+ */
+class output_port
+{
+public:
+  /// Generic settings for output ports, applied to every pin in the port
+  struct settings
+  {
+    /// Pull resistor for the pins. This generally only helpful when open
+    /// drain is enabled.
+    pin_resistor resistor = pin_resistor::none;
+
+    /// Starting level of the output pins. HIGH voltage defined as true and LOW
+    /// voltage defined as false.
+    bool open_drain = false;
+  };
+
+  /**
+   * @brief Feedback from setting the port state
+   *
+   * This structure is currently empty as no feedback has been determined for
+   * now. This structure may be expanded in the future.
+   */
+  struct set_value_t
+  {};
+
+  /// Port value reading structure
+  struct value_t
+  {
+    /// Current state of each pin of the port. Bits outside the width of the
+    /// port are zero.
+    uint32_t state;
+  };
+
+  /**
+   * @brief Configure the output port to match the settings supplied
+   *
+   * The settings are applied to every pin belonging to the port.
+   *
+   * @param p_settings - settings to apply to the output port
+   * @return status - success or failure
+   * @throws std::errc::invalid_argument if the settings could not be achieved.
+   */
+  [[nodiscard]] status configure(const settings& p_settings)
+  {
+    return driver_configure(p_settings);
+  }
+
+  /**
+   * @brief Set the state of a selection of pins in the port
+   *
+   * Pins whose bit in p_mask is 1 are set to the level of the corresponding
+   * bit of p_value, HIGH voltage for 1 and LOW voltage for 0. Pins whose bit
+   * in p_mask is 0 keep their current state. All selected pins change with a
+   * single port register update.
+   *
+   * @param p_mask - selects which pins of the port are updated
+   * @param p_value - levels to apply to the selected pins
+   * @return result<set_value_t> - success or failure
+   */
+  [[nodiscard]] result<set_value_t> write(uint32_t p_mask, uint32_t p_value)
+  {
+    return driver_write(p_mask, p_value);
+  }
+
+  /**
+   * @brief Read the current state of every pin in the port
+   *
+   * Implementations must read the pin states from hardware and will not
+   * simply cache the result from the execution of `write()`.
+   *
+   * The returned value may not equal the value set by `write()` when pins
+   * are configured as open-drain.
+   *
+   * @return result<value_t> - the current state of each pin of the port
+   */
+  [[nodiscard]] result<value_t> read()
+  {
+    return driver_read();
+  }
+
+  virtual ~output_port() = default;
+
+private:
+  virtual status driver_configure(const settings& p_settings) = 0;
+  virtual result<set_value_t> driver_write(uint32_t p_mask,
+                                           uint32_t p_value) = 0;
+  virtual result<value_t> driver_read() = 0;
+};
+}  // namespace hal
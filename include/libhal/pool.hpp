@@ -0,0 +1,302 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "error.hpp"
+#include "units.hpp"
+
+namespace hal {
+/**
+ * @brief Owning handle to a buffer acquired from a block_pool
+ *
+ * Returns its block to the pool on destruction. The handle converts to
+ * std::span<hal::byte> so it can be passed directly to the span-based
+ * interfaces such as serial::read, spi::transfer and i2c::transaction.
+ * Move-only: the block has exactly one owner at all times.
+ */
+class pool_buffer
+{
+public:
+  /**
+   * @brief Function that returns a block to its owning pool
+   *
+   */
+  using release_function = void(void* p_pool, hal::byte* p_block);
+
+  /**
+   * @brief Construct an empty handle owning no storage
+   *
+   */
+  pool_buffer() = default;
+
+  /**
+   * @brief Construct a handle over an acquired block
+   *
+   * Called by block_pool::acquire(), not by applications.
+   *
+   * @param p_pool - pool the block came from
+   * @param p_release - function returning the block to p_pool
+   * @param p_data - the block's storage
+   */
+  pool_buffer(void* p_pool,
+              release_function* p_release,
+              std::span<hal::byte> p_data)
+    : m_pool(p_pool)
+    , m_release(p_release)
+    , m_data(p_data)
+  {
+  }
+
+  pool_buffer(const pool_buffer&) = delete;
+  pool_buffer& operator=(const pool_buffer&) = delete;
+
+  pool_buffer(pool_buffer&& p_other) noexcept
+    : m_pool(p_other.m_pool)
+    , m_release(p_other.m_release)
+    , m_data(p_other.m_data)
+  {
+    p_other.m_release = nullptr;
+    p_other.m_data = {};
+  }
+
+  pool_buffer& operator=(pool_buffer&& p_other) noexcept
+  {
+    if (this != &p_other) {
+      release();
+      m_pool = p_other.m_pool;
+      m_release = p_other.m_release;
+      m_data = p_other.m_data;
+      p_other.m_release = nullptr;
+      p_other.m_data = {};
+    }
+    return *this;
+  }
+
+  ~pool_buffer()
+  {
+    release();
+  }
+
+  /**
+   * @brief The block's storage
+   *
+   * @return std::span<hal::byte> - writable view over the block
+   */
+  [[nodiscard]] std::span<hal::byte> data() const
+  {
+    return m_data;
+  }
+
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  operator std::span<hal::byte>() const
+  {
+    return m_data;
+  }
+
+  /**
+   * @brief Size of the block in bytes, zero for an empty handle
+   *
+   */
+  [[nodiscard]] size_t size() const
+  {
+    return m_data.size();
+  }
+
+  /**
+   * @brief True if this handle owns no storage
+   *
+   */
+  [[nodiscard]] bool empty() const
+  {
+    return m_data.empty();
+  }
+
+private:
+  void release()
+  {
+    if (m_release != nullptr) {
+      m_release(m_pool, m_data.data());
+      m_release = nullptr;
+      m_data = {};
+    }
+  }
+
+  void* m_pool = nullptr;
+  release_function* m_release = nullptr;
+  std::span<hal::byte> m_data{};
+};
+
+/**
+ * @brief Fixed-capacity pool of equally sized byte buffers
+ *
+ * Storage lives inside the object, so a pool can be declared statically and
+ * shared by every driver and application buffer of a compatible size in
+ * place of per-user worst-case static buffers. Acquire and release are O(1)
+ * freelist operations with no fragmentation.
+ *
+ * With InterruptSafe set to true, acquire and release become lock-free
+ * compare-and-swap operations on a generation-tagged freelist head and may
+ * be called concurrently from interrupt and thread context. The default
+ * keeps the freelist as plain loads and stores for single-context use.
+ *
+ * @tparam BlockSize - size of each buffer in bytes
+ * @tparam BlockCount - number of buffers in the pool
+ * @tparam InterruptSafe - select lock-free acquire and release
+ */
+template<size_t BlockSize, size_t BlockCount, bool InterruptSafe = false>
+class block_pool
+{
+public:
+  static_assert(BlockSize >= 1, "block_pool blocks must hold at least a byte");
+  static_assert(BlockCount >= 1 && BlockCount < 0xFFFF,
+                "block_pool must hold between 1 and 65534 blocks");
+
+  /// Size of each buffer in bytes
+  static constexpr size_t block_size = BlockSize;
+  /// Number of buffers in the pool
+  static constexpr size_t block_count = BlockCount;
+
+  block_pool()
+  {
+    for (std::uint16_t index = 0; index < BlockCount - 1; index++) {
+      m_next[index] = index + 1;
+    }
+    m_next[BlockCount - 1] = null_index;
+  }
+
+  block_pool(const block_pool&) = delete;
+  block_pool& operator=(const block_pool&) = delete;
+  block_pool(block_pool&&) = delete;
+  block_pool& operator=(block_pool&&) = delete;
+  ~block_pool() = default;
+
+  /**
+   * @brief Acquire a buffer from the pool
+   *
+   * @return result<pool_buffer> - handle that releases the buffer when
+   * destroyed
+   * @throws std::errc::not_enough_memory - when every block is in use.
+   */
+  [[nodiscard]] result<pool_buffer> acquire()
+  {
+    auto index = pop();
+    if (index == null_index) {
+      return hal::new_error(std::errc::not_enough_memory);
+    }
+    return pool_buffer(this, &block_pool::release_block, block(index));
+  }
+
+  /**
+   * @brief Number of buffers currently free
+   *
+   */
+  [[nodiscard]] size_t available() const
+  {
+    if constexpr (InterruptSafe) {
+      return m_available.load(std::memory_order_relaxed);
+    } else {
+      return m_available;
+    }
+  }
+
+private:
+  static constexpr std::uint16_t null_index = 0xFFFF;
+
+  static void release_block(void* p_pool, hal::byte* p_block)
+  {
+    auto* pool = static_cast<block_pool*>(p_pool);
+    auto offset = static_cast<size_t>(p_block - pool->m_storage.data());
+    pool->push(static_cast<std::uint16_t>(offset / BlockSize));
+  }
+
+  std::span<hal::byte> block(std::uint16_t p_index)
+  {
+    return std::span<hal::byte>(m_storage)
+      .subspan(static_cast<size_t>(p_index) * BlockSize, BlockSize);
+  }
+
+  std::uint16_t pop()
+  {
+    if constexpr (InterruptSafe) {
+      std::uint32_t head = m_head.load(std::memory_order_acquire);
+      while (true) {
+        auto index = static_cast<std::uint16_t>(head & 0xFFFF);
+        if (index == null_index) {
+          return null_index;
+        }
+        // Bump the generation tag in the upper half so a block released
+        // and re-acquired between the load and this exchange cannot be
+        // mistaken for an unchanged head.
+        std::uint32_t replacement =
+          ((head & 0xFFFF'0000) + 0x0001'0000) | m_next[index];
+        if (m_head.compare_exchange_weak(head,
+                                         replacement,
+                                         std::memory_order_acq_rel,
+                                         std::memory_order_acquire)) {
+          m_available.fetch_sub(1, std::memory_order_relaxed);
+          return index;
+        }
+      }
+    } else {
+      auto index = static_cast<std::uint16_t>(m_head & 0xFFFF);
+      if (index == null_index) {
+        return null_index;
+      }
+      m_head = m_next[index];
+      m_available--;
+      return index;
+    }
+  }
+
+  void push(std::uint16_t p_index)
+  {
+    if constexpr (InterruptSafe) {
+      std::uint32_t head = m_head.load(std::memory_order_acquire);
+      while (true) {
+        m_next[p_index] = static_cast<std::uint16_t>(head & 0xFFFF);
+        std::uint32_t replacement =
+          ((head & 0xFFFF'0000) + 0x0001'0000) | p_index;
+        if (m_head.compare_exchange_weak(head,
+                                         replacement,
+                                         std::memory_order_acq_rel,
+                                         std::memory_order_acquire)) {
+          m_available.fetch_add(1, std::memory_order_relaxed);
+          return;
+        }
+      }
+    } else {
+      m_next[p_index] = static_cast<std::uint16_t>(m_head & 0xFFFF);
+      m_head = p_index;
+      m_available++;
+    }
+  }
+
+  template<typename T>
+  using count_t = std::conditional_t<InterruptSafe, std::atomic<T>, T>;
+
+  alignas(alignof(std::max_align_t))
+    std::array<hal::byte, BlockSize * BlockCount> m_storage{};
+  std::array<std::uint16_t, BlockCount> m_next{};
+  count_t<std::uint32_t> m_head{ 0 };
+  count_t<size_t> m_available{ BlockCount };
+};
+}  // namespace hal
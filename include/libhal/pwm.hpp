@@ -66,11 +66,36 @@ public:
   /**
    * @brief Feedback setting the pwm frequency.
    *
-   * This structure is currently empty as no feedback has been determined for
-   * now. This structure may be expanded in the future.
    */
   struct frequency_t
-  {};
+  {
+    /**
+     * @brief Number of timer ticks in one waveform period at the achieved
+     * frequency
+     *
+     * Callers can pre-scale duty cycles into tick counts against this value
+     * and apply them with duty_ticks(), skipping the float scaling work the
+     * driver would otherwise perform on every duty cycle update. A value of
+     * 0 indicates that the driver does not report its tick resolution and
+     * duty_ticks() is unavailable.
+     */
+    std::uint32_t period_ticks = 0;
+  };
+
+  /**
+   * @brief Feedback from a combined frequency and duty cycle update.
+   *
+   */
+  struct waveform_t
+  {
+    /**
+     * @brief Number of timer ticks in one waveform period at the achieved
+     * frequency
+     *
+     * Follows the same rules as frequency_t::period_ticks.
+     */
+    std::uint32_t period_ticks = 0;
+  };
 
   /**
    * @brief Set the pwm waveform frequency
@@ -120,10 +145,101 @@ public:
     return driver_duty_cycle(clamped_duty_cycle);
   }
 
+  /**
+   * @brief Set the pwm waveform duty cycle using a fixed point ratio
+   *
+   * Follows the same proportionality rules as the float overload with a
+   * hal::q31 ratio in place of the float, allowing FPU-less platforms to set
+   * the duty cycle without any floating point arithmetic. Negative ratios are
+   * clamped to 0% so values passed to driver implementations are guaranteed
+   * to be between 0.0 and 1.0.
+   *
+   * Drivers that can compute their compare register value from the raw
+   * fixed point value should override the fixed point virtual; the default
+   * implementation converts the ratio to float and uses the float path.
+   *
+   * @param p_duty_cycle - a q31 ratio representing the duty cycle percentage
+   * @return result<duty_cycle_t> - success or failure
+   */
+  [[nodiscard]] result<duty_cycle_t> duty_cycle(q31 p_duty_cycle)
+  {
+    p_duty_cycle.raw = std::max(p_duty_cycle.raw, std::int32_t{ 0 });
+    return driver_duty_cycle(p_duty_cycle);
+  }
+
+  /**
+   * @brief Set the pwm waveform frequency and duty cycle together
+   *
+   * Use this in place of separate frequency() and duty_cycle() calls when
+   * both properties change at once. Implementations whose timers have
+   * shadow or buffered update registers should override the default
+   * implementation and latch both values into hardware on the same period
+   * boundary, so the output never carries the new frequency with the old
+   * duty cycle. The default implementation applies the frequency and then
+   * the duty cycle as two separate updates.
+   *
+   * Both inputs are clamped following the same rules as the individual
+   * frequency() and duty_cycle() APIs.
+   *
+   * @param p_frequency - the waveform frequency to apply
+   * @param p_duty_cycle - a value from 0.0f to +1.0f representing the duty
+   * cycle percentage.
+   * @return result<waveform_t> - success or failure
+   * @throws std::errc::argument_out_of_domain - if the frequency is beyond
+   * what the pwm generator is capable of achieving.
+   */
+  [[nodiscard]] result<waveform_t> waveform(hertz p_frequency,
+                                            float p_duty_cycle)
+  {
+    auto clamped_frequency = std::clamp(p_frequency, 1.0_Hz, 1.0_GHz);
+    auto clamped_duty_cycle = std::clamp(p_duty_cycle, 0.0f, 1.0f);
+    return driver_waveform(clamped_frequency, clamped_duty_cycle);
+  }
+
+  /**
+   * @brief Set the pwm waveform duty cycle as a raw tick count
+   *
+   * Sets the duration of the HIGH portion of the waveform to p_high_ticks
+   * timer ticks out of the period_ticks reported by the most recent
+   * frequency() or waveform() call. Callers updating the duty cycle at high
+   * rates can pre-scale their duty values into ticks once and skip the
+   * float multiply by the period that the proportional APIs perform on
+   * every call.
+   *
+   * Tick counts greater than the current period are clamped to the period
+   * by the implementing driver.
+   *
+   * @param p_high_ticks - duration of the HIGH portion of the waveform in
+   * timer ticks
+   * @return result<duty_cycle_t> - success or failure
+   * @throws std::errc::not_supported - if the driver does not expose its
+   * tick resolution, indicated by a period_ticks of 0.
+   */
+  [[nodiscard]] result<duty_cycle_t> duty_ticks(std::uint32_t p_high_ticks)
+  {
+    return driver_duty_ticks(p_high_ticks);
+  }
+
   virtual ~pwm() = default;
 
 private:
   virtual result<frequency_t> driver_frequency(hertz p_frequency) = 0;
   virtual result<duty_cycle_t> driver_duty_cycle(float p_duty_cycle) = 0;
+  virtual result<duty_cycle_t> driver_duty_cycle(q31 p_duty_cycle)
+  {
+    return driver_duty_cycle(p_duty_cycle.to_float());
+  }
+  virtual result<waveform_t> driver_waveform(hertz p_frequency,
+                                             float p_duty_cycle)
+  {
+    auto frequency_response = HAL_CHECK(driver_frequency(p_frequency));
+    HAL_CHECK(driver_duty_cycle(p_duty_cycle));
+    return waveform_t{ .period_ticks = frequency_response.period_ticks };
+  }
+  virtual result<duty_cycle_t> driver_duty_ticks(std::uint32_t p_high_ticks)
+  {
+    (void)p_high_ticks;
+    return hal::new_error(std::errc::not_supported);
+  }
 };
 }  // namespace hal
@@ -0,0 +1,146 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "error.hpp"
+#include "units.hpp"
+
+namespace hal {
+/**
+ * @brief Hardware quadrature decoder abstraction interface
+ *
+ * Use this interface for timer peripherals that decode the A/B phase
+ * signals of a quadrature encoder in silicon, maintaining an up/down count
+ * without any processor involvement. Reading the count is a single register
+ * load per control tick, replacing the per-edge `hal::interrupt_pin`
+ * callbacks that software decoding requires — thousands of interrupts per
+ * second at motor speeds.
+ *
+ * Drivers implementing `hal::rotation_sensor` for encoder hardware with a
+ * quadrature decoder should be built by wrapping this interface, converting
+ * counts to angles using `count_t::counts_per_revolution`.
+ */
+class quadrature_counter
+{
+public:
+  /**
+   * @brief Quadrature decoding resolutions
+   *
+   */
+  enum class decoding : uint8_t
+  {
+    /**
+     * @brief Count one edge per quadrature cycle
+     *
+     */
+    x1 = 0,
+    /**
+     * @brief Count two edges per quadrature cycle
+     *
+     */
+    x2,
+    /**
+     * @brief Count all four edges per quadrature cycle
+     *
+     */
+    x4,
+  };
+
+  /**
+   * @brief Generic settings for quadrature counters
+   *
+   */
+  struct settings
+  {
+    /**
+     * @brief Number of edges counted per quadrature cycle
+     *
+     * Higher resolutions multiply counts_per_revolution accordingly.
+     */
+    decoding mode = decoding::x4;
+  };
+
+  /**
+   * @brief Result from reading the quadrature counter.
+   *
+   * Matches the shape of `hal::rotation_sensor::count_t` so wrapping drivers
+   * can forward the reading directly.
+   */
+  struct count_t
+  {
+    /**
+     * @brief Accumulated signed count since configuration or the last reset
+     *
+     * Increases with rotation in one direction and decreases in the other.
+     * The hardware counter width is implementation-defined; drivers must
+     * extend narrower hardware counts to the full signed 64-bit range by
+     * accumulating overflows, so the value never wraps in practice.
+     */
+    std::int64_t count;
+    /**
+     * @brief Number of counts in one full revolution
+     *
+     * Determined by the encoder's line count and the configured decoding
+     * resolution. Guaranteed by the implementing driver to be non-zero.
+     */
+    std::uint32_t counts_per_revolution;
+  };
+
+  /**
+   * @brief Configure the quadrature counter to match the settings supplied
+   *
+   * @param p_settings - settings to apply to the quadrature counter
+   * @return status - success or failure
+   * @throws std::errc::invalid_argument if the settings could not be
+   * achieved, such as a decoding resolution the hardware cannot produce.
+   */
+  [[nodiscard]] status configure(const settings& p_settings)
+  {
+    return driver_configure(p_settings);
+  }
+
+  /**
+   * @brief Read the current accumulated count
+   *
+   * @return result<count_t> - the accumulated count data
+   */
+  [[nodiscard]] result<count_t> read()
+  {
+    return driver_read();
+  }
+
+  /**
+   * @brief Reset the accumulated count to zero
+   *
+   * Use this to establish a new reference position, such as after homing
+   * against a limit switch.
+   *
+   * @return status - success or failure
+   */
+  [[nodiscard]] status reset()
+  {
+    return driver_reset();
+  }
+
+  virtual ~quadrature_counter() = default;
+
+private:
+  virtual status driver_configure(const settings& p_settings) = 0;
+  virtual result<count_t> driver_read() = 0;
+  virtual status driver_reset() = 0;
+};
+}  // namespace hal
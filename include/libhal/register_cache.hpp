@@ -0,0 +1,240 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+
+#include "error.hpp"
+#include "functional.hpp"
+#include "i2c.hpp"
+#include "timeout.hpp"
+#include "units.hpp"
+
+namespace hal {
+/**
+ * @brief Write-through register cache for an i2c-attached device
+ *
+ * Device drivers for I/O expanders, PMICs and similar write-mostly parts
+ * re-read configuration registers before every modify. This cache keeps a
+ * RAM copy of a contiguous window of the device's register file: reads of
+ * clean registers are served from RAM without a bus transaction, writes go
+ * through to the device and update the copy, and staged writes flush as one
+ * auto-increment burst per run of consecutive dirty registers.
+ *
+ * Registers the device changes on its own (input ports, status flags) must
+ * be invalidated before reading, or left out of the cached window.
+ *
+ * @tparam RegisterCount - number of registers in the cached window
+ */
+template<size_t RegisterCount>
+class i2c_register_cache
+{
+public:
+  static_assert(RegisterCount >= 1 && RegisterCount <= 255,
+                "i2c_register_cache windows span 1 to 255 registers");
+
+  /**
+   * @brief Construct a cache over a device's register window
+   *
+   * All registers start invalid: the first read of each register fetches it
+   * from the device.
+   *
+   * @param p_bus - bus the device is attached to
+   * @param p_device_address - the device's 7-bit i2c address
+   * @param p_first_register - device register address of the first cached
+   * register. The window covers RegisterCount registers from here and the
+   * device must auto-increment its register pointer on multi-byte writes.
+   */
+  i2c_register_cache(hal::i2c& p_bus,
+                     hal::byte p_device_address,
+                     hal::byte p_first_register)
+    : m_bus(&p_bus)
+    , m_device_address(p_device_address)
+    , m_first_register(p_first_register)
+  {
+  }
+
+  /**
+   * @brief Read a register, from RAM when the cached copy is clean
+   *
+   * @param p_register - device register address to read
+   * @param p_timeout - amount of time to wait before timing out a bus read
+   * @return result<hal::byte> - the register's value
+   * @throws std::errc::invalid_argument - if the register lies outside the
+   * cached window.
+   */
+  [[nodiscard]] result<hal::byte> read(
+    hal::byte p_register,
+    hal::function_ref<hal::timeout_function> p_timeout)
+  {
+    auto index = HAL_CHECK(index_of(p_register));
+    if (!m_valid.test(index)) {
+      HAL_CHECK(m_bus->transaction(m_device_address,
+                                   std::span<const hal::byte>(&p_register, 1),
+                                   std::span<hal::byte>(&m_cache[index], 1),
+                                   p_timeout));
+      m_valid.set(index);
+    }
+    return m_cache[index];
+  }
+
+  /**
+   * @brief Write a register through to the device immediately
+   *
+   * The cached copy is updated on success, so a subsequent read costs no
+   * bus transaction.
+   *
+   * @param p_register - device register address to write
+   * @param p_value - value to write
+   * @param p_timeout - amount of time to wait before timing out the write
+   * @return status - success or failure
+   * @throws std::errc::invalid_argument - if the register lies outside the
+   * cached window.
+   */
+  [[nodiscard]] status write(hal::byte p_register,
+                             hal::byte p_value,
+                             hal::function_ref<hal::timeout_function> p_timeout)
+  {
+    auto index = HAL_CHECK(index_of(p_register));
+    std::array<hal::byte, 2> payload{ p_register, p_value };
+    HAL_CHECK(m_bus->transaction(m_device_address,
+                                 payload,
+                                 std::span<hal::byte>{},
+                                 p_timeout));
+    m_cache[index] = p_value;
+    m_valid.set(index);
+    m_dirty.reset(index);
+    return hal::success();
+  }
+
+  /**
+   * @brief Stage a register write in RAM without touching the bus
+   *
+   * Staged writes are sent by flush(). Consecutive staged registers
+   * coalesce into a single auto-increment burst.
+   *
+   * @param p_register - device register address to write
+   * @param p_value - value to write
+   * @return status - success or failure
+   * @throws std::errc::invalid_argument - if the register lies outside the
+   * cached window.
+   */
+  [[nodiscard]] status stage(hal::byte p_register, hal::byte p_value)
+  {
+    auto index = HAL_CHECK(index_of(p_register));
+    m_cache[index] = p_value;
+    m_valid.set(index);
+    m_dirty.set(index);
+    return hal::success();
+  }
+
+  /**
+   * @brief Send every staged write, one burst per run of consecutive dirty
+   * registers
+   *
+   * @param p_timeout - amount of time to wait before timing out each burst
+   * @return status - success or failure
+   */
+  [[nodiscard]] status flush(hal::function_ref<hal::timeout_function> p_timeout)
+  {
+    size_t index = 0;
+    while (index < RegisterCount) {
+      if (!m_dirty.test(index)) {
+        index++;
+        continue;
+      }
+      size_t run_end = index;
+      while (run_end < RegisterCount && m_dirty.test(run_end)) {
+        run_end++;
+      }
+      // One burst: register address followed by the run's values, relying
+      // on the device's auto-incrementing register pointer
+      std::array<hal::byte, RegisterCount + 1> payload{};
+      payload[0] = static_cast<hal::byte>(m_first_register + index);
+      size_t length = run_end - index;
+      for (size_t offset = 0; offset < length; offset++) {
+        payload[1 + offset] = m_cache[index + offset];
+      }
+      HAL_CHECK(m_bus->transaction(
+        m_device_address,
+        std::span<const hal::byte>(payload).first(length + 1),
+        std::span<hal::byte>{},
+        p_timeout));
+      for (size_t offset = index; offset < run_end; offset++) {
+        m_dirty.reset(offset);
+      }
+      index = run_end;
+    }
+    return hal::success();
+  }
+
+  /**
+   * @brief Discard the cached copy of a register
+   *
+   * Use for volatile registers the device updates on its own; the next
+   * read fetches from the device.
+   *
+   * @param p_register - device register address to invalidate
+   * @return status - success or failure
+   * @throws std::errc::invalid_argument - if the register lies outside the
+   * cached window.
+   */
+  [[nodiscard]] status invalidate(hal::byte p_register)
+  {
+    auto index = HAL_CHECK(index_of(p_register));
+    m_valid.reset(index);
+    m_dirty.reset(index);
+    return hal::success();
+  }
+
+  /**
+   * @brief Discard every cached copy, including staged writes
+   *
+   */
+  void invalidate_all()
+  {
+    m_valid.reset();
+    m_dirty.reset();
+  }
+
+  /**
+   * @brief Number of registers with staged, unflushed writes
+   *
+   */
+  [[nodiscard]] size_t dirty_count() const
+  {
+    return m_dirty.count();
+  }
+
+private:
+  [[nodiscard]] result<size_t> index_of(hal::byte p_register) const
+  {
+    if (p_register < m_first_register ||
+        p_register >= m_first_register + RegisterCount) {
+      return hal::new_error(std::errc::invalid_argument);
+    }
+    return static_cast<size_t>(p_register - m_first_register);
+  }
+
+  hal::i2c* m_bus;
+  std::array<hal::byte, RegisterCount> m_cache{};
+  std::bitset<RegisterCount> m_valid{};
+  std::bitset<RegisterCount> m_dirty{};
+  hal::byte m_device_address;
+  hal::byte m_first_register;
+};
+}  // namespace hal
@@ -0,0 +1,244 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @defgroup Retry Retry
+ * @file retry.hpp
+ * @brief Allocation-free retry and backoff policy engine built on the
+ * timeout primitives.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "error.hpp"
+#include "steady_clock.hpp"
+#include "timeout.hpp"
+#include "units.hpp"
+
+namespace hal {
+/**
+ * @ingroup Retry
+ * @brief Describes how an operation is retried after transient failures
+ *
+ * The delay before retry N is `initial_delay * backoff_factor^(N-1)`,
+ * capped at max_delay. A backoff_factor of 1.0 gives a fixed schedule.
+ * When jitter is non-zero, each delay is shortened by a pseudo-random
+ * fraction of up to `jitter` of its length, desynchronizing devices that
+ * share a bus and would otherwise retry in lockstep.
+ */
+struct retry_policy
+{
+  /**
+   * @brief Total number of attempts, including the first
+   *
+   */
+  size_t attempts = 3;
+  /**
+   * @brief Delay before the first retry
+   *
+   * A zero delay retries immediately, which in a polled worker still
+   * yields control between attempts.
+   */
+  hal::time_duration initial_delay = hal::time_duration::zero();
+  /**
+   * @brief Multiplier applied to the delay after each failed attempt
+   *
+   */
+  float backoff_factor = 2.0f;
+  /**
+   * @brief Upper bound on any single delay
+   *
+   */
+  hal::time_duration max_delay = std::chrono::seconds(1);
+  /**
+   * @brief Fraction of each delay randomized away, 0.0 to 1.0
+   *
+   */
+  float jitter = 0.0f;
+};
+
+/**
+ * @ingroup Retry
+ * @brief Runs one operation under a retry policy without allocating
+ *
+ * The operation is a callable returning `hal::status` that performs one
+ * complete attempt, typically a bus transaction wrapper. The retrier
+ * satisfies `hal::work_function`: each poll either runs an attempt, or
+ * returns `work_state::in_progress` without blocking while a backoff
+ * delay is pending, so a cooperative main loop keeps running between
+ * attempts instead of hammering a dead bus. The blocking `run()` form
+ * polls internally for callers that want the composed operation to
+ * behave like a plain call.
+ *
+ * Delays are converted to clock ticks once at construction; scheduling a
+ * retry costs integer arithmetic only.
+ *
+ * @tparam Operation - callable with signature `hal::status()`
+ */
+template<class Operation>
+class retrier
+{
+public:
+  /**
+   * @brief Construct a retrier around an operation
+   *
+   * @param p_clock - steady clock used to time backoff delays. Must
+   * outlive this object.
+   * @param p_policy - retry schedule to apply
+   * @param p_operation - the operation to attempt
+   */
+  retrier(hal::steady_clock& p_clock,
+          const retry_policy& p_policy,
+          Operation p_operation)
+    : m_clock(&p_clock)
+    , m_operation(std::move(p_operation))
+    , m_attempts(std::max<size_t>(p_policy.attempts, 1))
+    , m_backoff_factor(p_policy.backoff_factor)
+    , m_jitter(std::clamp(p_policy.jitter, 0.0f, 1.0f))
+  {
+    m_delay_ticks = to_ticks(p_clock, p_policy.initial_delay);
+    m_max_delay_ticks = to_ticks(p_clock, p_policy.max_delay);
+  }
+
+  /**
+   * @brief Poll the retried operation, following hal::work_function rules
+   *
+   * @return result<work_state> - in_progress while waiting out a backoff
+   * delay, finished once an attempt succeeds, and the final attempt's
+   * error once the policy is exhausted.
+   */
+  result<work_state> operator()()
+  {
+    if (m_state != work_state::in_progress) {
+      return m_state;
+    }
+    if (m_waiting) {
+      if (m_clock->uptime().ticks < m_resume_tick) {
+        return work_state::in_progress;
+      }
+      m_waiting = false;
+    }
+    auto attempt_result = m_operation();
+    if (attempt_result) {
+      m_state = work_state::finished;
+      return m_state;
+    }
+    m_attempts_made++;
+    if (m_attempts_made >= m_attempts) {
+      m_state = work_state::failed;
+      return attempt_result.error();
+    }
+    schedule_backoff();
+    return work_state::in_progress;
+  }
+
+  /**
+   * @brief Run the operation to completion under the policy, blocking
+   * through backoff delays
+   *
+   * @return status - success once an attempt succeeds, or the final
+   * attempt's error.
+   */
+  status run()
+  {
+    while (true) {
+      auto state = HAL_CHECK((*this)());
+      if (state == work_state::finished) {
+        return hal::success();
+      }
+    }
+  }
+
+private:
+  static std::uint64_t to_ticks(hal::steady_clock& p_clock,
+                                hal::time_duration p_duration)
+  {
+    constexpr float nanoseconds_per_second = 1'000'000'000.0f;
+    auto ticks_per_nanosecond =
+      p_clock.frequency().operating_frequency / nanoseconds_per_second;
+    auto duration_count = p_duration < hal::time_duration::zero()
+                            ? std::int64_t{ 0 }
+                            : p_duration.count();
+    return static_cast<std::uint64_t>(static_cast<float>(duration_count) *
+                                      ticks_per_nanosecond);
+  }
+
+  void schedule_backoff()
+  {
+    auto delay = m_delay_ticks;
+    if (m_jitter > 0.0f && delay > 0) {
+      auto jitter_span =
+        static_cast<std::uint64_t>(static_cast<float>(delay) * m_jitter);
+      if (jitter_span > 0) {
+        delay -= next_random() % (jitter_span + 1);
+      }
+    }
+    m_resume_tick = m_clock->uptime().ticks + delay;
+    m_waiting = true;
+    auto grown = static_cast<std::uint64_t>(static_cast<float>(m_delay_ticks) *
+                                            m_backoff_factor);
+    m_delay_ticks = std::min(grown, m_max_delay_ticks);
+  }
+
+  std::uint32_t next_random()
+  {
+    // xorshift32, seeded from the clock on first use
+    if (m_random_state == 0) {
+      m_random_state =
+        static_cast<std::uint32_t>(m_clock->uptime().ticks) | 1u;
+    }
+    m_random_state ^= m_random_state << 13;
+    m_random_state ^= m_random_state >> 17;
+    m_random_state ^= m_random_state << 5;
+    return m_random_state;
+  }
+
+  hal::steady_clock* m_clock;
+  Operation m_operation;
+  std::uint64_t m_delay_ticks;
+  std::uint64_t m_max_delay_ticks;
+  std::uint64_t m_resume_tick{ 0 };
+  std::uint32_t m_random_state{ 0 };
+  size_t m_attempts;
+  size_t m_attempts_made{ 0 };
+  float m_backoff_factor;
+  float m_jitter;
+  work_state m_state{ work_state::in_progress };
+  bool m_waiting{ false };
+};
+
+/**
+ * @ingroup Retry
+ * @brief Run an operation to completion under a retry policy
+ *
+ * Convenience for the blocking form: constructs a retrier and runs it.
+ *
+ * @param p_clock - steady clock used to time backoff delays
+ * @param p_policy - retry schedule to apply
+ * @param p_operation - callable with signature `hal::status()` performing
+ * one complete attempt
+ * @return status - success once an attempt succeeds, or the final
+ * attempt's error.
+ */
+template<class Operation>
+[[nodiscard]] status retry(hal::steady_clock& p_clock,
+                           const retry_policy& p_policy,
+                           Operation&& p_operation)
+{
+  retrier engine(p_clock, p_policy, std::forward<Operation>(p_operation));
+  return engine.run();
+}
+}  // namespace hal
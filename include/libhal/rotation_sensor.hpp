@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "error.hpp"
 #include "units.hpp"
 
@@ -91,6 +93,30 @@ public:
     degrees angle;
   };
 
+  /**
+   * @brief Result from reading the raw accumulated count.
+   *
+   */
+  struct count_t
+  {
+    /**
+     * @brief Accumulated signed count since measurement started
+     *
+     * Increases with rotation in the positive angle direction and decreases
+     * with rotation in the negative angle direction. Unlike the float angle,
+     * the count does not lose precision as its magnitude grows.
+     */
+    std::int64_t count;
+    /**
+     * @brief Number of counts in one full revolution
+     *
+     * Constant for the device, allowing count deltas to be converted to
+     * angles or velocities when needed. Guaranteed by the implementing
+     * driver to be non-zero.
+     */
+    std::uint32_t counts_per_revolution;
+  };
+
   /**
    * @brief Read the current angle measured by the device
    *
@@ -101,9 +127,37 @@ public:
     return driver_read();
   }
 
+  /**
+   * @brief Read the raw accumulated count measured by the device
+   *
+   * Use this in place of read() for control loops that operate on count
+   * deltas, such as encoder velocity loops. Reading the count directly
+   * keeps the loop in pure integer math, skipping the conversion to float
+   * degrees and back and the precision loss of large float angles after
+   * long periods of continuous rotation.
+   *
+   * Count based measurement only applies to devices that measure rotation
+   * in discrete steps, such as quadrature and incremental encoders. Drivers
+   * for devices without a native count, such as rotary potentiometers,
+   * will throw `std::errc::not_supported` and callers should fall back to
+   * read().
+   *
+   * @return result<count_t> - accumulated count data
+   * @throws std::errc::not_supported - if the device does not measure
+   * rotation in discrete counts.
+   */
+  [[nodiscard]] result<count_t> count()
+  {
+    return driver_count();
+  }
+
   virtual ~rotation_sensor() = default;
 
 private:
   virtual result<read_t> driver_read() = 0;
+  virtual result<count_t> driver_count()
+  {
+    return hal::new_error(std::errc::not_supported);
+  }
 };
 }  // namespace hal
@@ -0,0 +1,188 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @defgroup SampleBlock Sample Block
+ * @file sample_block.hpp
+ * @brief Provides a struct-of-arrays block container for high-rate
+ * three-axis sample logging.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "units.hpp"
+#include "vec3.hpp"
+
+namespace hal {
+/**
+ * @ingroup SampleBlock
+ * @brief Struct-of-arrays container for timestamped three-axis samples
+ *
+ * Stores each axis in its own contiguous array alongside a tick timestamp
+ * array, rather than as an array of hal::vec3. Per-axis layout is what
+ * post-processing wants: filtering or integrating one axis walks one dense
+ * float array, which compilers can vectorize, instead of striding through
+ * interleaved structs. Loggers keep one block per sensor — accelerometer,
+ * gyroscope, magnetometer — and append each control tick's sample with its
+ * timestamp.
+ *
+ * The block is trivially copyable with no indirection, so a filled block
+ * serializes to its flash or transport buffer with the single memcpy of the
+ * span returned by as_bytes(); no field-by-field repacking is involved.
+ *
+ * @tparam Capacity - number of samples the block holds
+ */
+template<size_t Capacity>
+class sample_block
+{
+public:
+  static_assert(Capacity > 0, "sample_block requires a non-zero capacity");
+
+  /// Number of samples the block can hold
+  static constexpr size_t capacity = Capacity;
+
+  /**
+   * @brief Append one timestamped sample to the block
+   *
+   * @param p_tick - steady clock tick the sample was taken at
+   * @param p_sample - the three axis values
+   * @return bool - false if the block was already full and the sample was
+   * dropped
+   */
+  constexpr bool append(std::uint64_t p_tick, const vec3& p_sample)
+  {
+    if (m_size == Capacity) {
+      return false;
+    }
+    m_tick[m_size] = p_tick;
+    m_x[m_size] = p_sample.x;
+    m_y[m_size] = p_sample.y;
+    m_z[m_size] = p_sample.z;
+    m_size++;
+    return true;
+  }
+
+  /**
+   * @brief Transpose a batch of samples into the block
+   *
+   * Accepts the buffer filled by the x/y/z sensor batch read APIs along
+   * with the tick of the first sample and the tick period between samples,
+   * as known from the device's output data rate. Samples beyond the block's
+   * remaining capacity are dropped.
+   *
+   * @param p_first_tick - steady clock tick of the first sample
+   * @param p_tick_period - ticks between consecutive samples
+   * @param p_samples - samples to append, oldest first
+   * @return size_t - number of samples appended
+   */
+  constexpr size_t append(std::uint64_t p_first_tick,
+                          std::uint64_t p_tick_period,
+                          std::span<const vec3> p_samples)
+  {
+    size_t appended = 0;
+    for (const auto& sample : p_samples) {
+      if (!append(p_first_tick + appended * p_tick_period, sample)) {
+        break;
+      }
+      appended++;
+    }
+    return appended;
+  }
+
+  /// Number of samples currently in the block
+  [[nodiscard]] constexpr size_t size() const
+  {
+    return m_size;
+  }
+
+  /// True when no further samples can be appended
+  [[nodiscard]] constexpr bool full() const
+  {
+    return m_size == Capacity;
+  }
+
+  /// Timestamps of the stored samples, oldest first
+  [[nodiscard]] constexpr std::span<const std::uint64_t> ticks() const
+  {
+    return std::span<const std::uint64_t>(m_tick).first(m_size);
+  }
+
+  /// X axis values of the stored samples
+  [[nodiscard]] constexpr std::span<const float> x() const
+  {
+    return std::span<const float>(m_x).first(m_size);
+  }
+
+  /// Y axis values of the stored samples
+  [[nodiscard]] constexpr std::span<const float> y() const
+  {
+    return std::span<const float>(m_y).first(m_size);
+  }
+
+  /// Z axis values of the stored samples
+  [[nodiscard]] constexpr std::span<const float> z() const
+  {
+    return std::span<const float>(m_z).first(m_size);
+  }
+
+  /**
+   * @brief Reconstruct the sample at an index
+   *
+   * Convenience for consumers that want one sample across all axes; bulk
+   * processing should iterate the per-axis spans instead.
+   *
+   * @param p_index - index of the sample, must be below size()
+   * @return vec3 - the three axis values at that index
+   */
+  [[nodiscard]] constexpr vec3 sample(size_t p_index) const
+  {
+    return vec3{ .x = m_x[p_index], .y = m_y[p_index], .z = m_z[p_index] };
+  }
+
+  /**
+   * @brief View the whole block as bytes for serialization
+   *
+   * The view spans the entire block including unfilled capacity, so every
+   * block written to storage has the same length and the reader recovers
+   * the valid sample count from the serialized size field.
+   *
+   * @return std::span<const hal::byte> - byte view of this block
+   */
+  [[nodiscard]] std::span<const hal::byte> as_bytes() const
+  {
+    return std::span<const hal::byte>(
+      reinterpret_cast<const hal::byte*>(this), sizeof(*this));
+  }
+
+  /**
+   * @brief Empty the block for reuse
+   *
+   */
+  constexpr void clear()
+  {
+    m_size = 0;
+  }
+
+private:
+  std::array<std::uint64_t, Capacity> m_tick{};
+  std::array<float, Capacity> m_x{};
+  std::array<float, Capacity> m_y{};
+  std::array<float, Capacity> m_z{};
+  std::uint32_t m_size = 0;
+};
+}  // namespace hal
@@ -0,0 +1,88 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @defgroup Sampling Sampling
+ * @file sampling.hpp
+ * @brief Shared types for negotiating sample rate and resolution.
+ */
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include "units.hpp"
+
+namespace hal {
+/**
+ * @ingroup Sampling
+ * @brief Acceptable ranges for a device's sample rate and resolution
+ *
+ * Used by the configure() APIs of hal::adc and the sampling sensor
+ * interfaces. Rather than demanding an exact operating point the caller
+ * states the ranges it can accept, and the driver selects the operating
+ * point its hardware actually supports within them. The shared layout
+ * lets fusion code negotiate every sensor in a pipeline with one routine.
+ *
+ * The defaults accept anything, so a caller can constrain only the
+ * dimension it cares about.
+ */
+struct sampling_settings
+{
+  /**
+   * @brief Lowest acceptable sample rate
+   *
+   */
+  hertz min_sample_rate = 0.0f;
+  /**
+   * @brief Highest acceptable sample rate
+   *
+   */
+  hertz max_sample_rate = std::numeric_limits<float>::max();
+  /**
+   * @brief Minimum acceptable number of significant bits per sample
+   *
+   */
+  uint8_t min_bits = 1;
+  /**
+   * @brief Maximum acceptable number of significant bits per sample
+   *
+   */
+  uint8_t max_bits = 32;
+};
+
+/**
+ * @ingroup Sampling
+ * @brief The operating point a device actually achieved
+ *
+ * Returned by the configure() APIs so callers can size batch reads and
+ * filters from the true output data rate instead of polling defensively
+ * above it.
+ */
+struct sampling_t
+{
+  /**
+   * @brief Sample rate the device is producing
+   *
+   * May differ from any requested value due to clock divider or output
+   * data rate granularity, but falls within the requested range.
+   */
+  hertz sample_rate;
+  /**
+   * @brief Number of significant bits in each sample
+   *
+   */
+  uint8_t bits;
+};
+}  // namespace hal
@@ -0,0 +1,155 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @defgroup Scheduler Scheduler
+ * @file scheduler.hpp
+ * @brief Provides a fixed-capacity cooperative scheduler for work functions.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "error.hpp"
+#include "functional.hpp"
+#include "timeout.hpp"
+
+namespace hal {
+/**
+ * @ingroup Scheduler
+ * @brief Fixed-capacity round-robin scheduler for hal::work_function workers
+ *
+ * Runs any number of resumable operations concurrently where try_until()
+ * drives only one to completion at a time. Register each worker, then call
+ * run_once() repeatedly: every pass polls each active worker once in
+ * registration order and retires workers that reach a terminal state, so
+ * long-running transfers on independent buses make progress side by side
+ * instead of serializing. Capacity is fixed at compile time and no memory
+ * is allocated.
+ *
+ * Workers are owned by the scheduler through the same inplace function
+ * type used by the asynchronous bus APIs, so the workers they return can
+ * be registered directly. Poll-compatible objects that cannot be copied,
+ * such as hal::task, can be registered through a lambda capturing them by
+ * reference.
+ *
+ * @tparam Capacity - maximum number of concurrently registered workers
+ */
+template<size_t Capacity>
+class scheduler
+{
+public:
+  /**
+   * @brief Owning storage type for a registered worker
+   *
+   * Matches the capacity of the workers returned by the asynchronous bus
+   * APIs, such as i2c::transaction_worker and serial::write_worker.
+   */
+  using worker_type =
+    hal::inplace_function<hal::work_function, sizeof(std::intptr_t) * 8>;
+
+  /**
+   * @brief Feedback from registering a worker with the scheduler.
+   *
+   * This structure is currently empty as no feedback has been determined for
+   * now. This structure may be expanded in the future.
+   */
+  struct add_t
+  {};
+
+  /**
+   * @brief Register a worker to be polled on each pass
+   *
+   * @param p_worker - the worker to run. Retired automatically once it
+   * returns a terminal state.
+   * @return result<add_t> - success or failure
+   * @throws std::errc::not_enough_memory - if the scheduler already holds
+   * Capacity unretired workers.
+   */
+  [[nodiscard]] result<add_t> add(worker_type p_worker)
+  {
+    for (auto& slot : m_slots) {
+      if (!slot.active) {
+        slot.work = std::move(p_worker);
+        slot.active = true;
+        m_active++;
+        return add_t{};
+      }
+    }
+    return hal::new_error(std::errc::not_enough_memory);
+  }
+
+  /**
+   * @brief Poll every active worker once in round-robin order
+   *
+   * Workers returning a terminal state are retired, freeing their slot for
+   * future add() calls. A worker that returns an error is retired and its
+   * error is returned from this pass; the workers after it are polled on
+   * the next pass, so one failing transfer cannot permanently starve its
+   * peers.
+   *
+   * @return result<work_state> - `work_state::in_progress` while any worker
+   * remains active, `work_state::finished` once every worker has finished,
+   * or the error of a worker that failed during this pass.
+   */
+  [[nodiscard]] result<work_state> run_once()
+  {
+    for (auto& slot : m_slots) {
+      if (!slot.active) {
+        continue;
+      }
+      auto state = slot.work();
+      if (!state) {
+        retire(slot);
+        return state.error();
+      }
+      if (state.value() != work_state::in_progress) {
+        retire(slot);
+      }
+    }
+    if (m_active == 0) {
+      return work_state::finished;
+    }
+    return work_state::in_progress;
+  }
+
+  /**
+   * @brief Number of workers currently registered and unretired
+   *
+   */
+  [[nodiscard]] size_t active() const
+  {
+    return m_active;
+  }
+
+private:
+  struct slot_t
+  {
+    worker_type work{};
+    bool active = false;
+  };
+
+  void retire(slot_t& p_slot)
+  {
+    p_slot.active = false;
+    p_slot.work = worker_type{};
+    m_active--;
+  }
+
+  std::array<slot_t, Capacity> m_slots{};
+  size_t m_active = 0;
+};
+}  // namespace hal
@@ -14,12 +14,16 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <span>
 
 #include "error.hpp"
+#include "functional.hpp"
+#include "instrumentation.hpp"
+#include "timeout.hpp"
 #include "units.hpp"
 
 namespace hal {
@@ -165,6 +169,40 @@ public:
     std::span<const hal::byte> data;
   };
 
+  /**
+   * @brief Return type for scatter-gather serial write operations
+   *
+   */
+  struct write_vector_t
+  {
+    /**
+     * @brief Total number of bytes transmitted across all segments
+     *
+     */
+    size_t transmitted;
+  };
+
+  /**
+   * @brief Return type for zero-copy serial borrow operations
+   *
+   */
+  struct borrow_t
+  {
+    /**
+     * @brief Views into the serial driver's internal working buffer
+     *
+     * Because the working buffer is circular, the received bytes may wrap
+     * around the end of the underlying storage, and thus up to two contiguous
+     * views are needed to observe all of them. The first span holds the
+     * oldest received bytes. The second span is only non-empty when the data
+     * has wrapped around. Empty spans indicate no received data.
+     *
+     * These views are invalidated by any call to read(), flush(), consume()
+     * or by destruction of the serial driver.
+     */
+    std::array<std::span<const hal::byte>, 2> data{};
+  };
+
   /**
    * @brief Feedback from performing a flush operation
    *
@@ -198,7 +236,80 @@ public:
    */
   [[nodiscard]] result<write_t> write(std::span<const hal::byte> p_data)
   {
-    return driver_write(p_data);
+    instrument::scope telemetry(instrument::tag::serial_write);
+    auto response = driver_write(p_data);
+    telemetry.complete(bool{ response },
+                       response ? response.value().data.size() : 0);
+    return response;
+  }
+
+  /**
+   * @brief Write a sequence of segments to the transmitter line in order
+   *
+   * Transmits the segments back to back as if they were one contiguous
+   * buffer, without requiring the caller to stage them into one. Packet
+   * protocols whose header, payload and trailer live in separate buffers
+   * use this to send a frame with neither a staging memcpy nor one
+   * virtual write per segment. Drivers with DMA transmitters should
+   * override the default implementation and chain the segments into a
+   * single descriptor sequence; the default transmits each segment with
+   * the blocking write() path.
+   *
+   * Unlike the single-span write(), this call does not return until every
+   * byte of every segment has been handed to the hardware. Empty segments
+   * are permitted and transmit nothing.
+   *
+   * @param p_segments - segments to be transmitted back to back
+   * @return result<write_vector_t> - total bytes transmitted
+   */
+  [[nodiscard]] result<write_vector_t> write(
+    std::span<const std::span<const hal::byte>> p_segments)
+  {
+    instrument::scope telemetry(instrument::tag::serial_write);
+    auto response = driver_write(p_segments);
+    telemetry.complete(bool{ response },
+                       response ? response.value().transmitted : 0);
+    return response;
+  }
+
+  /**
+   * @brief Owning resumable handle to an in-flight asynchronous write
+   *
+   * Created by `write_async()`. Call the worker repeatedly to poll the state
+   * of the transmission. Follows the rules of `hal::work_function`, meaning
+   * that once a terminal state is returned the worker must not be called
+   * again with the expectation of additional work being performed.
+   */
+  using write_worker =
+    hal::inplace_function<hal::work_function, sizeof(std::intptr_t) * 8>;
+
+  /**
+   * @brief Write data to the transmitter line without blocking until it has
+   * been transmitted
+   *
+   * The returned worker reports `work_state::in_progress` until every byte
+   * of the span has been handed to the hardware, at which point it returns
+   * `work_state::finished`, or an error if transmission failed.
+   * Implementations with interrupt or DMA driven transmitters should
+   * override the default implementation such that transmission proceeds in
+   * the background and each call to the worker simply samples its progress.
+   *
+   * The default implementation transmits with the blocking write() API on
+   * each poll of the returned worker, advancing past however many bytes that
+   * call transmitted, which bounds each poll's blocking cost to what the
+   * driver accepts synchronously.
+   *
+   * The span passed to this function must stay alive and unmodified until
+   * the worker has reached a terminal state or has been destroyed.
+   *
+   * @param p_data - data to be transmitted over the serial port
+   * @return result<write_worker> - worker to poll for completion, or an
+   * error if the transmission could not be started.
+   */
+  [[nodiscard]] result<write_worker> write_async(
+    std::span<const hal::byte> p_data)
+  {
+    return driver_write_async(p_data);
   }
 
   /**
@@ -233,6 +344,50 @@ public:
   {
     return driver_read(p_data);
   }
+  /**
+   * @brief Borrow views of the received bytes without copying them out
+   *
+   * This operation is an alternative to read() for parsers that can consume
+   * the received bytes in place. The returned views point directly into the
+   * serial driver's internal working buffer and no bytes are removed from it.
+   * Once the bytes have been processed, call consume() to release them back
+   * to the driver. Repeated calls to borrow() without an intervening
+   * consume() return views over the same bytes, potentially extended with
+   * newly received data.
+   *
+   * Not all serial drivers can support borrowing, such as those whose
+   * internal buffer resides in hardware FIFOs that must be drained by copy.
+   * Such drivers will throw `std::errc::not_supported` and callers should
+   * fall back to read().
+   *
+   * @return result<borrow_t> - views into the internal working buffer
+   * @throws std::errc::not_supported - if the serial driver cannot provide
+   * direct views into its working buffer.
+   */
+  [[nodiscard]] result<borrow_t> borrow()
+  {
+    return driver_borrow();
+  }
+
+  /**
+   * @brief Release bytes previously observed via borrow()
+   *
+   * Removes the oldest p_count bytes from the internal working buffer,
+   * freeing their storage for newly received data. Invalidate any
+   * previously returned borrow_t views.
+   *
+   * @param p_count - number of bytes to remove from the working buffer. If
+   * this exceeds the number of bytes currently stored, the working buffer is
+   * emptied.
+   * @return status - success or failure
+   * @throws std::errc::not_supported - if the serial driver cannot provide
+   * direct views into its working buffer.
+   */
+  [[nodiscard]] status consume(size_t p_count)
+  {
+    return driver_consume(p_count);
+  }
+
   /**
    * @brief Flush working buffer
    *
@@ -255,7 +410,50 @@ public:
 private:
   virtual status driver_configure(const settings& p_settings) = 0;
   virtual result<write_t> driver_write(std::span<const hal::byte> p_data) = 0;
+  virtual result<write_vector_t> driver_write(
+    std::span<const std::span<const hal::byte>> p_segments)
+  {
+    size_t transmitted = 0;
+    for (auto segment : p_segments) {
+      while (!segment.empty()) {
+        auto write_result = HAL_CHECK(driver_write(segment));
+        transmitted += write_result.data.size();
+        segment = segment.subspan(write_result.data.size());
+      }
+    }
+    return write_vector_t{ .transmitted = transmitted };
+  }
   virtual result<read_t> driver_read(std::span<hal::byte> p_data) = 0;
+  virtual result<write_worker> driver_write_async(
+    std::span<const hal::byte> p_data)
+  {
+    return write_worker(
+      [this, remaining = p_data,
+       state = work_state::in_progress]() mutable -> result<work_state> {
+        if (state != work_state::in_progress) {
+          return state;
+        }
+        auto write_result = driver_write(remaining);
+        if (!write_result) {
+          state = work_state::failed;
+          return write_result.error();
+        }
+        remaining = remaining.subspan(write_result.value().data.size());
+        if (remaining.empty()) {
+          state = work_state::finished;
+        }
+        return state;
+      });
+  }
+  virtual result<borrow_t> driver_borrow()
+  {
+    return hal::new_error(std::errc::not_supported);
+  }
+  virtual status driver_consume(size_t p_count)
+  {
+    (void)p_count;
+    return hal::new_error(std::errc::not_supported);
+  }
   virtual result<flush_t> driver_flush() = 0;
 };
 }  // namespace hal
@@ -0,0 +1,142 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include "error.hpp"
+#include "servo.hpp"
+#include "units.hpp"
+
+namespace hal {
+/**
+ * @brief Hardware abstraction for synchronized updates of multiple servos
+ *
+ * Use this interface when an application commands several servos on each
+ * control frame. Multi-channel driver chips, such as I2C PWM expanders,
+ * can commit an entire batch of position commands with a single
+ * auto-increment burst write, costing one bus transaction for the whole
+ * group rather than one per servo and landing every update simultaneously.
+ * Drivers for such chips should implement this interface alongside the
+ * per-channel hal::servo objects they expose.
+ *
+ * Applications whose servos are independent devices can use
+ * hal::independent_servo_group to program against the same batch model.
+ */
+class servo_group
+{
+public:
+  /**
+   * @brief A position command for a single servo within the group
+   *
+   */
+  struct command
+  {
+    /**
+     * @brief Which servo in the group to move
+     *
+     * Drivers that implement this interface must document how channel
+     * numbers map to their output channels.
+     */
+    size_t channel;
+    /**
+     * @brief The position to move the servo shaft to in degrees
+     *
+     * Follows the same range rules as the single hal::servo position API.
+     */
+    hal::degrees position;
+  };
+
+  /**
+   * @brief Feedback from committing a group update
+   *
+   * This structure is currently empty as no feedback has been determined for
+   * now. This structure may be expanded in the future.
+   */
+  struct update_t
+  {};
+
+  /**
+   * @brief Commit a batch of servo position commands as one update
+   *
+   * If any command within the batch fails, the behavior of the remaining
+   * commands is driver-defined: chips that commit the batch atomically will
+   * reject the whole batch, whereas per-channel fallbacks stop at the
+   * failing command.
+   *
+   * @param p_commands - list of position commands to commit together
+   * @return result<update_t> - success or failure
+   * @throws std::errc::invalid_argument - when a command's channel does not
+   * exist in the group. When this error occurs, the guaranteed behavior is
+   * that every servo in the group keeps its last set position.
+   * @throws hal::servo::range_error - when a command's position exceeds the
+   * range of its servo, following the same rules as the single servo API.
+   */
+  [[nodiscard]] result<update_t> update(std::span<const command> p_commands)
+  {
+    return driver_update(p_commands);
+  }
+
+  virtual ~servo_group() = default;
+
+private:
+  virtual result<update_t> driver_update(
+    std::span<const command> p_commands) = 0;
+};
+
+/**
+ * @brief servo_group implementation over independent hal::servo objects
+ *
+ * Allows applications to program against the batch update model even when
+ * their servos are unrelated devices without shared-bus burst support. Each
+ * command is applied with its servo's single position API, one at a time, so
+ * there is no transaction saving, only API uniformity.
+ */
+class independent_servo_group : public servo_group
+{
+public:
+  /**
+   * @brief Construct the group over a list of servos
+   *
+   * @param p_servos - the servos making up the group, indexed by channel.
+   * The list and the servos within it must outlive this object.
+   */
+  explicit independent_servo_group(std::span<servo* const> p_servos)
+    : m_servos(p_servos)
+  {
+  }
+
+  ~independent_servo_group() override = default;
+
+private:
+  result<update_t> driver_update(std::span<const command> p_commands) override
+  {
+    // Validate every channel before moving anything, so a bad channel late
+    // in the batch cannot leave earlier servos already repositioned
+    for (const auto& entry : p_commands) {
+      if (entry.channel >= m_servos.size()) {
+        return hal::new_error(std::errc::invalid_argument);
+      }
+    }
+    for (const auto& entry : p_commands) {
+      HAL_CHECK(m_servos[entry.channel]->position(entry.position));
+    }
+    return update_t{};
+  }
+
+  std::span<servo* const> m_servos;
+};
+}  // namespace hal
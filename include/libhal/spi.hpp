@@ -14,11 +14,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <span>
 
 #include "error.hpp"
+#include "instrumentation.hpp"
 #include "units.hpp"
 
 namespace hal {
@@ -66,6 +68,31 @@ public:
   /// the write buffer has been exhausted.
   static constexpr hal::byte default_filler = hal::byte{ 0xFF };
 
+  /**
+   * @brief Description of a single segment within a multi-segment transfer
+   *
+   * The data_out, data_in and filler fields follow the same rules as the
+   * parameters of the single `transfer()` API.
+   */
+  struct transfer_segment
+  {
+    /**
+     * @brief Buffer to write data to the bus during this segment
+     *
+     */
+    std::span<const hal::byte> data_out;
+    /**
+     * @brief Buffer to read data off of the bus during this segment
+     *
+     */
+    std::span<hal::byte> data_in;
+    /**
+     * @brief Filler data placed on the bus when data_out has been exhausted
+     *
+     */
+    hal::byte filler = default_filler;
+  };
+
   /**
    * @brief Configure spi to match the settings supplied
    *
@@ -99,7 +126,35 @@ public:
     std::span<hal::byte> p_data_in,
     hal::byte p_filler = default_filler)
   {
-    return driver_transfer(p_data_out, p_data_in, p_filler);
+    instrument::scope telemetry(instrument::tag::spi_transfer);
+    auto response = driver_transfer(p_data_out, p_data_in, p_filler);
+    telemetry.complete(bool{ response },
+                       std::max(p_data_out.size(), p_data_in.size()));
+    return response;
+  }
+
+  /**
+   * @brief Send and receive a sequence of segments as one continuous bus
+   * transfer. This function will block until every segment is finished.
+   *
+   * Use this to transfer frames composed of multiple non-contiguous buffers,
+   * such as a command header followed by a payload, without staging them into
+   * a single contiguous buffer first. Implementations with hardware support
+   * are encouraged to override the default implementation and map the
+   * segments onto a DMA descriptor chain so the bus clock never pauses
+   * between segments. The default implementation performs each segment in
+   * order using the single transfer API.
+   *
+   * If any segment within the sequence fails, the sequence is abandoned at
+   * that segment and the error is returned to the caller.
+   *
+   * @param p_segments - list of segments to transfer in order
+   * @return result<transfer_t> - success or failure
+   */
+  [[nodiscard]] result<transfer_t> transfer(
+    std::span<const transfer_segment> p_segments)
+  {
+    return driver_transfer(p_segments);
   }
 
   virtual ~spi() = default;
@@ -110,5 +165,15 @@ private:
     std::span<const hal::byte> p_data_out,
     std::span<hal::byte> p_data_in,
     hal::byte p_filler) = 0;
+  virtual result<transfer_t> driver_transfer(
+    std::span<const transfer_segment> p_segments)
+  {
+    transfer_t response{};
+    for (const auto& segment : p_segments) {
+      response = HAL_CHECK(
+        driver_transfer(segment.data_out, segment.data_in, segment.filler));
+    }
+    return response;
+  }
 };
 }  // namespace hal
@@ -0,0 +1,228 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @defgroup StaticDispatch Static Dispatch
+ * @file static_dispatch.hpp
+ * @brief Concepts and adapters for using drivers without virtual dispatch.
+ *
+ * The abstract interfaces in this library dispatch every operation through a
+ * virtual call. For most drivers this cost is irrelevant, but for operations
+ * that amount to a single register access, such as toggling a GPIO pin,
+ * virtual dispatch blocks inlining and dominates the cost of the operation.
+ *
+ * The concepts in this file describe drivers structurally: any type with the
+ * same public API as the corresponding abstract interface satisfies the
+ * concept, whether or not it inherits from that interface. Performance
+ * critical code can be written as templates constrained on these concepts and
+ * handed the concrete platform driver directly, allowing the compiler to
+ * inline every operation. At system boundaries where type erasure is desired,
+ * the adapter class templates wrap any conforming driver back into the
+ * matching abstract interface.
+ */
+#pragma once
+
+#include <concepts>
+#include <span>
+
+#include "adc.hpp"
+#include "error.hpp"
+#include "functional.hpp"
+#include "i2c.hpp"
+#include "output_pin.hpp"
+#include "spi.hpp"
+#include "timeout.hpp"
+#include "units.hpp"
+
+namespace hal {
+/**
+ * @ingroup StaticDispatch
+ * @brief Concept for types providing the hal::output_pin API
+ *
+ */
+template<class T>
+concept output_pin_driver =
+  requires(T& p_driver, const output_pin::settings& p_settings, bool p_high) {
+    { p_driver.configure(p_settings) } -> std::same_as<status>;
+    { p_driver.level(p_high) } -> std::same_as<result<output_pin::set_level_t>>;
+    { p_driver.level() } -> std::same_as<result<output_pin::level_t>>;
+  };
+
+/**
+ * @ingroup StaticDispatch
+ * @brief Concept for types providing the hal::spi API
+ *
+ */
+template<class T>
+concept spi_driver = requires(T& p_driver,
+                              const spi::settings& p_settings,
+                              std::span<const hal::byte> p_data_out,
+                              std::span<hal::byte> p_data_in,
+                              hal::byte p_filler) {
+  { p_driver.configure(p_settings) } -> std::same_as<status>;
+  {
+    p_driver.transfer(p_data_out, p_data_in, p_filler)
+  } -> std::same_as<result<spi::transfer_t>>;
+};
+
+/**
+ * @ingroup StaticDispatch
+ * @brief Concept for types providing the hal::i2c API
+ *
+ */
+template<class T>
+concept i2c_driver = requires(T& p_driver,
+                              const i2c::settings& p_settings,
+                              hal::byte p_address,
+                              std::span<const hal::byte> p_data_out,
+                              std::span<hal::byte> p_data_in,
+                              hal::function_ref<hal::timeout_function> p_timeout) {
+  { p_driver.configure(p_settings) } -> std::same_as<status>;
+  {
+    p_driver.transaction(p_address, p_data_out, p_data_in, p_timeout)
+  } -> std::same_as<result<i2c::transaction_t>>;
+};
+
+/**
+ * @ingroup StaticDispatch
+ * @brief Concept for types providing the hal::adc API
+ *
+ */
+template<class T>
+concept adc_driver = requires(T& p_driver) {
+  { p_driver.read() } -> std::same_as<result<adc::read_t>>;
+};
+
+/**
+ * @ingroup StaticDispatch
+ * @brief Wrap an output_pin_driver into the hal::output_pin interface
+ *
+ * Use this at system boundaries where type erasure is required but the driver
+ * itself is used statically elsewhere. The adapter does not own the driver,
+ * which must outlive it.
+ *
+ * @tparam T - type of the wrapped driver
+ */
+template<output_pin_driver T>
+class output_pin_adapter : public output_pin
+{
+public:
+  constexpr output_pin_adapter(T& p_driver)
+    : m_driver(&p_driver)
+  {
+  }
+
+private:
+  status driver_configure(const settings& p_settings) override
+  {
+    return m_driver->configure(p_settings);
+  }
+  result<set_level_t> driver_level(bool p_high) override
+  {
+    return m_driver->level(p_high);
+  }
+  result<level_t> driver_level() override
+  {
+    return m_driver->level();
+  }
+
+  T* m_driver;
+};
+
+/**
+ * @ingroup StaticDispatch
+ * @brief Wrap an spi_driver into the hal::spi interface
+ *
+ * @tparam T - type of the wrapped driver
+ */
+template<spi_driver T>
+class spi_adapter : public spi
+{
+public:
+  constexpr spi_adapter(T& p_driver)
+    : m_driver(&p_driver)
+  {
+  }
+
+private:
+  status driver_configure(const settings& p_settings) override
+  {
+    return m_driver->configure(p_settings);
+  }
+  result<transfer_t> driver_transfer(std::span<const hal::byte> p_data_out,
+                                     std::span<hal::byte> p_data_in,
+                                     hal::byte p_filler) override
+  {
+    return m_driver->transfer(p_data_out, p_data_in, p_filler);
+  }
+
+  T* m_driver;
+};
+
+/**
+ * @ingroup StaticDispatch
+ * @brief Wrap an i2c_driver into the hal::i2c interface
+ *
+ * @tparam T - type of the wrapped driver
+ */
+template<i2c_driver T>
+class i2c_adapter : public i2c
+{
+public:
+  constexpr i2c_adapter(T& p_driver)
+    : m_driver(&p_driver)
+  {
+  }
+
+private:
+  status driver_configure(const settings& p_settings) override
+  {
+    return m_driver->configure(p_settings);
+  }
+  result<transaction_t> driver_transaction(
+    hal::byte p_address,
+    std::span<const hal::byte> p_data_out,
+    std::span<hal::byte> p_data_in,
+    hal::function_ref<hal::timeout_function> p_timeout) override
+  {
+    return m_driver->transaction(p_address, p_data_out, p_data_in, p_timeout);
+  }
+
+  T* m_driver;
+};
+
+/**
+ * @ingroup StaticDispatch
+ * @brief Wrap an adc_driver into the hal::adc interface
+ *
+ * @tparam T - type of the wrapped driver
+ */
+template<adc_driver T>
+class adc_adapter : public adc
+{
+public:
+  constexpr adc_adapter(T& p_driver)
+    : m_driver(&p_driver)
+  {
+  }
+
+private:
+  result<read_t> driver_read() override
+  {
+    return m_driver->read();
+  }
+
+  T* m_driver;
+};
+}  // namespace hal
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 
 #include "error.hpp"
@@ -93,10 +95,114 @@ public:
     return driver_uptime();
   }
 
+  /**
+   * @brief Get the low 32 bits of the steady clock's tick count
+   *
+   * Fast path for short interval measurement in tight polling loops. The
+   * value wraps around at 2^32 ticks, so intervals must be computed with
+   * unsigned subtraction (`now - start`) and stay below the wrap period.
+   * Drivers backed by a 32-bit hardware counter should override
+   * driver_uptime32() to return the raw counter, skipping the overflow
+   * extension work that uptime() performs.
+   *
+   * @return std::uint32_t - low 32 bits of the tick count
+   */
+  [[nodiscard]] std::uint32_t uptime32()
+  {
+    return driver_uptime32();
+  }
+
   virtual ~steady_clock() = default;
 
 private:
   virtual frequency_t driver_frequency() = 0;
   virtual uptime_t driver_uptime() = 0;
+  virtual std::uint32_t driver_uptime32()
+  {
+    return static_cast<std::uint32_t>(driver_uptime().ticks);
+  }
+};
+
+/**
+ * @brief Allocation-free overflow extension of a hardware counter to 64 bits
+ *
+ * Standard utility for steady_clock drivers backed by a free-running
+ * hardware counter narrower than 64 bits: feed every raw counter read
+ * through update() and it splices an overflow count on top. Wraparound is
+ * detected from the counter's top bit, so update() must be called at least
+ * once per half period of the hardware counter (2^31 ticks of a 32-bit
+ * counter) or overflows are missed.
+ *
+ * update() must be called from a single execution context. The state word
+ * itself is a 32-bit atomic and cannot tear, but wrap detection relies on
+ * counts being observed in order: a caller that samples the counter just
+ * before a wrap and is preempted across a concurrent update() re-applies
+ * its stale observation afterwards, counting the wrap twice and returning
+ * a timestamp from the future. Drivers whose uptime() can be called from
+ * both thread and interrupt context must guard update() with a short
+ * critical section, or route all updates through one context.
+ *
+ * @tparam CountBitWidth - bit width of the hardware counter, 24 for a
+ * SysTick style counter, 32 for a full-width counter
+ */
+template<size_t CountBitWidth = 32>
+class overflow_counter
+{
+public:
+  static_assert(2 <= CountBitWidth && CountBitWidth <= 32,
+                "overflow_counter supports counters of 2 to 32 bits");
+
+  /**
+   * @brief Extend a raw counter read to a 64-bit tick count
+   *
+   * Must not race with other update() calls; see the class description for
+   * the single execution context requirement.
+   *
+   * @param p_count - current value of the hardware counter
+   * @return std::uint64_t - counter value extended with the overflow count
+   */
+  std::uint64_t update(std::uint32_t p_count) noexcept
+  {
+    p_count &= count_mask;
+    std::uint32_t top_bit = p_count >> (CountBitWidth - 1);
+    std::uint32_t state = m_state.load(std::memory_order_acquire);
+    while (true) {
+      std::uint32_t previous_top_bit = state & 1;
+      std::uint32_t overflows = state >> 1;
+      if (previous_top_bit == 1 && top_bit == 0) {
+        overflows++;
+      }
+      std::uint32_t replacement = (overflows << 1) | top_bit;
+      if (replacement == state) {
+        break;
+      }
+      if (m_state.compare_exchange_weak(state,
+                                        replacement,
+                                        std::memory_order_acq_rel,
+                                        std::memory_order_acquire)) {
+        state = replacement;
+        break;
+      }
+    }
+    return (static_cast<std::uint64_t>(state >> 1) << CountBitWidth) |
+           p_count;
+  }
+
+  /**
+   * @brief Discard the overflow count and start over
+   *
+   */
+  void reset() noexcept
+  {
+    m_state.store(0, std::memory_order_relaxed);
+  }
+
+private:
+  static constexpr std::uint32_t count_mask =
+    (CountBitWidth == 32) ? 0xFFFF'FFFF : ((1U << CountBitWidth) - 1);
+
+  // Bit 0 holds the top bit of the last observed count, the remaining bits
+  // hold the overflow count.
+  std::atomic<std::uint32_t> m_state{ 0 };
 };
 }  // namespace hal
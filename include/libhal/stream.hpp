@@ -0,0 +1,280 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @defgroup Stream Stream
+ * @file stream.hpp
+ * @brief Composable zero-copy framing stages over hal::serial.
+ */
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <tuple>
+
+#include "error.hpp"
+#include "serial.hpp"
+#include "units.hpp"
+
+namespace hal {
+/**
+ * @ingroup Stream
+ * @brief Concept for an in-place byte stream transformation stage
+ *
+ * A stage is a callable that accepts the mutable bytes of one frame and
+ * returns the transformed bytes, which must be a prefix of the same storage
+ * (decoders shrink frames in place, validators pass them through untouched).
+ * Because a stage never writes outside the span it was given, chaining
+ * stages adds no copies: each stage reads what the previous one wrote.
+ *
+ * Stages signal malformed frames by returning an error, which the pipeline
+ * propagates to the caller without delivering the frame.
+ */
+template<class T>
+concept stream_stage = requires(T p_stage, std::span<hal::byte> p_frame) {
+  { p_stage(p_frame) } -> std::same_as<result<std::span<hal::byte>>>;
+};
+
+/**
+ * @ingroup Stream
+ * @brief Splits a serial byte stream into delimiter-terminated frames
+ *
+ * Reads from a hal::serial directly into a caller supplied frame buffer, so
+ * received bytes are copied exactly once before they reach the application.
+ * Bytes accumulate across calls until the delimiter is seen, at which point
+ * the completed frame (delimiter excluded) is handed to the caller as a span
+ * into the frame buffer. Transformation stages such as cobs_decode then
+ * operate on that span in place.
+ *
+ * A frame must fit within the frame buffer. The buffer should therefore be
+ * sized to the largest encoded frame the protocol permits.
+ */
+class stream_framer
+{
+public:
+  /**
+   * @brief Construct a framer over a serial port
+   *
+   * @param p_serial - serial port to pull bytes from. Must outlive this
+   * object.
+   * @param p_frame_buffer - storage that frames are accumulated into.
+   * Returned frame spans point into this buffer and are invalidated by the
+   * next call to read_frame(). Must outlive this object.
+   * @param p_delimiter - byte value that terminates a frame, such as 0x00
+   * for COBS, 0xC0 for SLIP, or '\n' for line oriented protocols.
+   */
+  stream_framer(hal::serial& p_serial,
+                std::span<hal::byte> p_frame_buffer,
+                hal::byte p_delimiter)
+    : m_serial(&p_serial)
+    , m_buffer(p_frame_buffer)
+    , m_delimiter(p_delimiter)
+  {
+  }
+
+  /**
+   * @brief Poll for the next complete frame
+   *
+   * Pulls whatever bytes the serial port has queued into the frame buffer
+   * and scans for the delimiter. Returns the completed frame with the
+   * delimiter removed, or an empty span if no complete frame has arrived
+   * yet. Empty frames (two adjacent delimiters) are skipped.
+   *
+   * @return result<std::span<hal::byte>> - the next frame, or an empty span
+   * when no frame is available yet
+   * @throws std::errc::no_buffer_space - the frame buffer filled without a
+   * delimiter appearing. The accumulated bytes are discarded and framing
+   * resumes at the next delimiter.
+   */
+  [[nodiscard]] result<std::span<hal::byte>> read_frame()
+  {
+    discard_delivered_frame();
+
+    while (true) {
+      // Scan bytes that have not been inspected yet for the delimiter
+      while (m_scanned < m_size) {
+        if (m_buffer[m_scanned] != m_delimiter) {
+          m_scanned++;
+          continue;
+        }
+        auto frame = m_buffer.first(m_scanned);
+        m_delivered = m_scanned + 1;
+        if (frame.empty()) {
+          discard_delivered_frame();
+          continue;
+        }
+        return frame;
+      }
+
+      if (m_size == m_buffer.size()) {
+        m_size = 0;
+        m_scanned = 0;
+        m_resynchronizing = true;
+        return hal::new_error(std::errc::no_buffer_space);
+      }
+
+      auto read_result = HAL_CHECK(m_serial->read(m_buffer.subspan(m_size)));
+      if (read_result.data.empty()) {
+        return std::span<hal::byte>{};
+      }
+      if (m_resynchronizing) {
+        // Drop bytes belonging to the oversized frame that overflowed the
+        // buffer, resuming reception at the byte after its delimiter.
+        auto delimiter = std::find(
+          read_result.data.begin(), read_result.data.end(), m_delimiter);
+        if (delimiter == read_result.data.end()) {
+          continue;
+        }
+        m_resynchronizing = false;
+        auto remainder_offset =
+          static_cast<size_t>(std::distance(read_result.data.begin(),
+                                            delimiter)) +
+          1;
+        auto remainder = read_result.data.subspan(remainder_offset);
+        std::copy(remainder.begin(), remainder.end(), m_buffer.begin());
+        m_size = remainder.size();
+        continue;
+      }
+      m_size += read_result.data.size();
+    }
+  }
+
+private:
+  void discard_delivered_frame()
+  {
+    if (m_delivered == 0) {
+      return;
+    }
+    std::copy(m_buffer.begin() + static_cast<std::ptrdiff_t>(m_delivered),
+              m_buffer.begin() + static_cast<std::ptrdiff_t>(m_size),
+              m_buffer.begin());
+    m_size -= m_delivered;
+    m_scanned = 0;
+    m_delivered = 0;
+  }
+
+  hal::serial* m_serial;
+  std::span<hal::byte> m_buffer;
+  size_t m_size{ 0 };
+  size_t m_scanned{ 0 };
+  size_t m_delivered{ 0 };
+  hal::byte m_delimiter;
+  bool m_resynchronizing{ false };
+};
+
+/**
+ * @ingroup Stream
+ * @brief In-place COBS (Consistent Overhead Byte Stuffing) decoder stage
+ *
+ * Decodes a COBS encoded frame, as produced for transmission over a zero
+ * delimited link, back into its original bytes. Decoding happens strictly in
+ * place: the read position always leads the write position, so no scratch
+ * buffer is required and the returned span is a prefix of the input span.
+ */
+struct cobs_decode
+{
+  /**
+   * @brief Decode one COBS frame in place
+   *
+   * @param p_frame - encoded frame with the trailing zero delimiter already
+   * removed, as delivered by stream_framer
+   * @return result<std::span<hal::byte>> - the decoded bytes
+   * @throws std::errc::bad_message - the frame contains a zero byte or a
+   * group code that runs past the end of the frame
+   */
+  result<std::span<hal::byte>> operator()(std::span<hal::byte> p_frame)
+  {
+    size_t read = 0;
+    size_t write = 0;
+    while (read < p_frame.size()) {
+      const auto code = p_frame[read++];
+      if (code == 0x00 || read + (code - 1U) > p_frame.size()) {
+        return hal::new_error(std::errc::bad_message);
+      }
+      for (hal::byte index = 1; index < code; index++) {
+        p_frame[write++] = p_frame[read++];
+      }
+      if (code != 0xFF && read < p_frame.size()) {
+        p_frame[write++] = 0x00;
+      }
+    }
+    return p_frame.first(write);
+  }
+};
+
+/**
+ * @ingroup Stream
+ * @brief Chains a stream_framer with in-place transformation stages
+ *
+ * Combines frame extraction with an ordered list of stream_stage callables
+ * into a single pull interface. Each completed frame flows through the
+ * stages left to right, every stage rewriting the frame storage in place, so
+ * a pipeline such as serial -> COBS decode -> CRC check delivers frames to
+ * the application with only the single copy performed by the framer.
+ *
+ * @tparam Stages - stage callables applied in order to each frame
+ */
+template<stream_stage... Stages>
+class stream_pipeline
+{
+public:
+  /**
+   * @brief Construct a pipeline from a framer and its stages
+   *
+   * @param p_framer - source of complete frames. Must outlive this object.
+   * @param p_stages - stages applied to each frame in declaration order
+   */
+  explicit stream_pipeline(stream_framer& p_framer, Stages... p_stages)
+    : m_framer(&p_framer)
+    , m_stages(std::move(p_stages)...)
+  {
+  }
+
+  /**
+   * @brief Poll for the next fully transformed frame
+   *
+   * Returns an empty span when no complete frame has arrived. Errors from
+   * the framer or any stage propagate to the caller; the frame that failed
+   * a stage is discarded and the next call resumes with the following frame.
+   *
+   * @return result<std::span<hal::byte>> - the transformed frame, or an
+   * empty span when no frame is available yet
+   */
+  [[nodiscard]] result<std::span<hal::byte>> read_frame()
+  {
+    auto frame = HAL_CHECK(m_framer->read_frame());
+    if (frame.empty()) {
+      return frame;
+    }
+    return apply_stages<0>(frame);
+  }
+
+private:
+  template<size_t index>
+  result<std::span<hal::byte>> apply_stages(std::span<hal::byte> p_frame)
+  {
+    if constexpr (index == sizeof...(Stages)) {
+      return p_frame;
+    } else {
+      auto transformed = HAL_CHECK(std::get<index>(m_stages)(p_frame));
+      return apply_stages<index + 1>(transformed);
+    }
+  }
+
+  stream_framer* m_framer;
+  std::tuple<Stages...> m_stages;
+};
+}  // namespace hal
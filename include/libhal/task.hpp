@@ -0,0 +1,366 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @defgroup Task Task
+ * @file task.hpp
+ * @brief Provides the hal::task coroutine type for cooperative drivers.
+ */
+#pragma once
+
+#include <array>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <utility>
+
+#include "error.hpp"
+#include "timeout.hpp"
+
+/**
+ * @brief Size in bytes of each coroutine frame block in the task frame pool
+ *
+ * Task coroutine frames are allocated from a fixed pool of statically
+ * allocated blocks rather than the heap. A coroutine whose frame exceeds
+ * this size fails to start and reports `std::errc::not_enough_memory`
+ * through the task, as does starting more concurrent tasks than
+ * LIBHAL_TASK_FRAME_COUNT. Define these macros project-wide to resize the
+ * pool.
+ */
+#ifndef LIBHAL_TASK_FRAME_SIZE
+#define LIBHAL_TASK_FRAME_SIZE 512
+#endif
+
+/**
+ * @brief Number of coroutine frame blocks in the task frame pool
+ *
+ */
+#ifndef LIBHAL_TASK_FRAME_COUNT
+#define LIBHAL_TASK_FRAME_COUNT 8
+#endif
+
+namespace hal {
+/**
+ * @ingroup Task
+ * @brief Fixed pool of statically allocated coroutine frame blocks
+ *
+ * Backs every hal::task coroutine frame so that tasks never touch the heap.
+ * Allocation and deallocation are constant time over a free list. Not safe
+ * to share between threads or with interrupt context.
+ */
+class task_frame_pool
+{
+public:
+  static task_frame_pool& instance()
+  {
+    static task_frame_pool pool;
+    return pool;
+  }
+
+  void* allocate(std::size_t p_size)
+  {
+    if (p_size > LIBHAL_TASK_FRAME_SIZE || m_free == nullptr) {
+      return nullptr;
+    }
+    frame* block = m_free;
+    m_free = block->next_free;
+    return block->storage.data();
+  }
+
+  void deallocate(void* p_address)
+  {
+    if (p_address == nullptr) {
+      return;
+    }
+    auto* block = reinterpret_cast<frame*>(p_address);
+    block->next_free = m_free;
+    m_free = block;
+  }
+
+private:
+  union alignas(alignof(std::max_align_t)) frame
+  {
+    frame* next_free;
+    std::array<std::byte, LIBHAL_TASK_FRAME_SIZE> storage;
+  };
+
+  task_frame_pool()
+  {
+    for (std::size_t index = 0; index + 1 < m_frames.size(); index++) {
+      m_frames[index].next_free = &m_frames[index + 1];
+    }
+    m_frames.back().next_free = nullptr;
+    m_free = m_frames.data();
+  }
+
+  std::array<frame, LIBHAL_TASK_FRAME_COUNT> m_frames{};
+  frame* m_free = nullptr;
+};
+
+/**
+ * @ingroup Task
+ * @brief Awaitable that suspends the current task until its next poll
+ *
+ * Use `co_await hal::yield` inside a task between polls of an operation
+ * that has not finished yet, returning control to whatever is polling the
+ * task. The next poll resumes execution after the co_await.
+ */
+struct yield_t
+{
+  constexpr bool await_ready() const noexcept
+  {
+    return false;
+  }
+  constexpr void await_suspend(std::coroutine_handle<>) const noexcept
+  {
+  }
+  constexpr void await_resume() const noexcept
+  {
+  }
+};
+
+/// Instance of hal::yield_t for `co_await hal::yield` expressions
+inline constexpr yield_t yield{};
+
+/**
+ * @ingroup Task
+ * @brief Allocator-free coroutine handle for multi-step driver operations
+ *
+ * Replaces hand-written `work_function` state machines: a coroutine
+ * returning `task<T>` reads as straight-line code, suspending at each
+ * `co_await` instead of blocking. Polling the task with `operator()`
+ * resumes it and reports `hal::work_state` exactly like a work_function,
+ * so tasks compose with `hal::try_until` and round-robin polling loops.
+ * Tasks can `co_await` other tasks, which runs the child to completion
+ * before resuming the parent, and finish with `co_return` of a
+ * `result<T>` value or error.
+ *
+ * Coroutine frames are allocated from hal::task_frame_pool. When the pool
+ * is exhausted or the frame does not fit a block, the task is created in a
+ * failed state and polls report `std::errc::not_enough_memory`; no other
+ * allocation failure path exists. Tasks are move-only and destroy their
+ * frame on destruction, cancelling the operation if it has not finished.
+ *
+ * @tparam T - type produced by the task on success. Use `void` for tasks
+ * that produce only success or failure, finishing with
+ * `co_return hal::success()`.
+ */
+template<typename T = void>
+class [[nodiscard]] task
+{
+public:
+  struct promise_type;
+  using handle_type = std::coroutine_handle<promise_type>;
+
+  /**
+   * @brief Shared state between a task promise and its poller
+   *
+   * Tracks the parent coroutine to resume when this coroutine finishes and
+   * the root task's current-leaf slot, which always names the coroutine to
+   * resume on the next poll.
+   */
+  struct promise_base
+  {
+    std::coroutine_handle<> m_continuation{};
+    std::coroutine_handle<>* m_current = nullptr;
+    // Current-leaf slot, used only by the root coroutine of a task tree. It
+    // lives in the coroutine frame rather than the task object so that
+    // moving the task cannot invalidate promise pointers to it.
+    std::coroutine_handle<> m_current_slot{};
+  };
+
+  struct promise_type : promise_base
+  {
+    static void* operator new(std::size_t p_size) noexcept
+    {
+      return task_frame_pool::instance().allocate(p_size);
+    }
+
+    static void operator delete(void* p_address) noexcept
+    {
+      task_frame_pool::instance().deallocate(p_address);
+    }
+
+    static task get_return_object_on_allocation_failure()
+    {
+      return task(nullptr);
+    }
+
+    task get_return_object()
+    {
+      return task(handle_type::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() noexcept
+    {
+      return {};
+    }
+
+    auto final_suspend() noexcept
+    {
+      struct final_awaiter
+      {
+        bool await_ready() const noexcept
+        {
+          return false;
+        }
+        std::coroutine_handle<> await_suspend(handle_type p_self) noexcept
+        {
+          auto& promise = p_self.promise();
+          if (promise.m_continuation) {
+            if (promise.m_current != nullptr) {
+              *promise.m_current = promise.m_continuation;
+            }
+            return promise.m_continuation;
+          }
+          return std::noop_coroutine();
+        }
+        void await_resume() const noexcept
+        {
+        }
+      };
+      return final_awaiter{};
+    }
+
+    void return_value(result<T> p_value)
+    {
+      m_value.emplace(std::move(p_value));
+    }
+
+    void unhandled_exception()
+    {
+      std::terminate();
+    }
+
+    std::optional<result<T>> m_value{};
+  };
+
+  task(task&& p_other) noexcept
+    : m_handle(std::exchange(p_other.m_handle, nullptr))
+  {
+  }
+
+  task& operator=(task&& p_other) noexcept
+  {
+    if (this != &p_other) {
+      destroy();
+      m_handle = std::exchange(p_other.m_handle, nullptr);
+    }
+    return *this;
+  }
+
+  task(const task&) = delete;
+  task& operator=(const task&) = delete;
+
+  ~task()
+  {
+    destroy();
+  }
+
+  /**
+   * @brief Poll the task, resuming its deepest unfinished co_await
+   *
+   * Follows the rules of `hal::work_function`: reports
+   * `work_state::in_progress` until the coroutine has run to completion,
+   * then `work_state::finished` on success or the task's error. Once a
+   * terminal state is returned the task must not be polled again with the
+   * expectation of additional work being performed.
+   *
+   * @return result<work_state> - the state of the task after this poll
+   * @throws std::errc::not_enough_memory - if the coroutine frame could not
+   * be allocated from the task frame pool.
+   */
+  result<work_state> operator()()
+  {
+    if (!m_handle) {
+      return hal::new_error(std::errc::not_enough_memory);
+    }
+    if (!m_handle.done()) {
+      auto& promise = m_handle.promise();
+      if (promise.m_current == nullptr) {
+        promise.m_current = &promise.m_current_slot;
+        promise.m_current_slot = m_handle;
+      }
+      promise.m_current_slot.resume();
+    }
+    if (!m_handle.done()) {
+      return work_state::in_progress;
+    }
+    auto& value = m_handle.promise().m_value;
+    if (value && !*value) {
+      return value->error();
+    }
+    return work_state::finished;
+  }
+
+  /**
+   * @brief Take the value produced by a finished task
+   *
+   * @return result<T> - the task's value or error
+   * @throws std::errc::operation_in_progress - if the task has not finished.
+   * @throws std::errc::not_enough_memory - if the coroutine frame could not
+   * be allocated from the task frame pool.
+   */
+  result<T> value()
+  {
+    if (!m_handle) {
+      return hal::new_error(std::errc::not_enough_memory);
+    }
+    if (!m_handle.done() || !m_handle.promise().m_value) {
+      return hal::new_error(std::errc::operation_in_progress);
+    }
+    return std::move(*m_handle.promise().m_value);
+  }
+
+  bool await_ready() const noexcept
+  {
+    return m_handle == nullptr || m_handle.done();
+  }
+
+  template<typename ParentPromise>
+  std::coroutine_handle<> await_suspend(
+    std::coroutine_handle<ParentPromise> p_parent)
+  {
+    auto& promise = m_handle.promise();
+    promise.m_continuation = p_parent;
+    promise.m_current = p_parent.promise().m_current;
+    if (promise.m_current != nullptr) {
+      *promise.m_current = m_handle;
+    }
+    return m_handle;
+  }
+
+  result<T> await_resume()
+  {
+    return value();
+  }
+
+private:
+  explicit task(handle_type p_handle)
+    : m_handle(p_handle)
+  {
+  }
+
+  void destroy()
+  {
+    if (m_handle) {
+      m_handle.destroy();
+      m_handle = nullptr;
+    }
+  }
+
+  handle_type m_handle;
+};
+}  // namespace hal
@@ -0,0 +1,217 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @defgroup Telemetry Telemetry
+ * @file telemetry.hpp
+ * @brief Compact binary telemetry record format and on-target encoder.
+ *
+ * Record wire format, all multi-byte fields little-endian:
+ *
+ *     offset  size  field
+ *     0       1     sync byte, always 0xA5
+ *     1       1     channel, application assigned stream identifier
+ *     2       1     type, one of telemetry_type
+ *     3       1     length, payload size in bytes
+ *     4       8     timestamp, steady clock ticks
+ *     12      N     payload, layout determined by type
+ *     12+N    1     checksum, two's complement of the byte sum of
+ *                   offsets 0 through 12+N-1, so summing a whole record
+ *                   including the checksum yields 0x00
+ *
+ * Payload layouts by type: `f32` is one IEEE-754 float (N = 4), `vec3` is
+ * three floats ordered x, y, z (N = 12), `u32` is one unsigned integer
+ * (N = 4), `bytes` is an opaque application buffer (N = length). A host
+ * decoder scans for 0xA5, reads the fixed 12-byte header, consumes
+ * `length` payload bytes plus the checksum, and resynchronizes on the next
+ * 0xA5 after any checksum failure. Records are self-describing, so new
+ * channels require no decoder changes.
+ */
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#include "error.hpp"
+#include "serial.hpp"
+#include "steady_clock.hpp"
+#include "units.hpp"
+#include "vec3.hpp"
+
+namespace hal {
+/**
+ * @ingroup Telemetry
+ * @brief Payload type carried by a telemetry record
+ *
+ */
+enum class telemetry_type : hal::byte
+{
+  /// One 32-bit IEEE-754 float
+  f32 = 1,
+  /// Three 32-bit floats ordered x, y, z
+  vec3 = 2,
+  /// One unsigned 32-bit integer
+  u32 = 3,
+  /// Opaque application defined bytes
+  bytes = 4,
+};
+
+/**
+ * @ingroup Telemetry
+ * @brief Allocation-free encoder emitting binary telemetry records
+ *
+ * Replaces printf-formatted text telemetry: each sample becomes a fixed
+ * binary record carrying the raw value and a steady clock timestamp,
+ * encoded into a stack buffer and written through `serial::write` in one
+ * call. Binary records are a fraction of the size of their text rendering
+ * and cost integer stores instead of float formatting, so the same UART
+ * carries several times more channels at a sliver of the encoder CPU.
+ *
+ * Channel numbers identify streams to the host; assign one per logged
+ * quantity and keep the mapping in the host decoder's configuration.
+ */
+class telemetry_encoder
+{
+public:
+  /**
+   * @brief Construct an encoder over a serial port
+   *
+   * @param p_serial - serial port records are written to. Must outlive this
+   * object.
+   * @param p_clock - steady clock used to timestamp each record. Must
+   * outlive this object.
+   */
+  telemetry_encoder(hal::serial& p_serial, hal::steady_clock& p_clock)
+    : m_serial(&p_serial)
+    , m_clock(&p_clock)
+  {
+  }
+
+  /**
+   * @brief Encode and write one float record
+   *
+   * @param p_channel - stream identifier of the value
+   * @param p_value - value to record
+   * @return status - success or failure of the underlying serial write
+   */
+  [[nodiscard]] status write(hal::byte p_channel, float p_value)
+  {
+    return write_record(p_channel,
+                        telemetry_type::f32,
+                        as_payload(std::bit_cast<std::uint32_t>(p_value)));
+  }
+
+  /**
+   * @brief Encode and write one three-axis sample record
+   *
+   * Carries the x/y/z sensor interfaces' read_t payload directly.
+   *
+   * @param p_channel - stream identifier of the sample
+   * @param p_sample - sample to record
+   * @return status - success or failure of the underlying serial write
+   */
+  [[nodiscard]] status write(hal::byte p_channel, const hal::vec3& p_sample)
+  {
+    std::array<hal::byte, 12> payload{};
+    auto x = as_payload(std::bit_cast<std::uint32_t>(p_sample.x));
+    auto y = as_payload(std::bit_cast<std::uint32_t>(p_sample.y));
+    auto z = as_payload(std::bit_cast<std::uint32_t>(p_sample.z));
+    std::memcpy(&payload[0], x.data(), x.size());
+    std::memcpy(&payload[4], y.data(), y.size());
+    std::memcpy(&payload[8], z.data(), z.size());
+    return write_record(p_channel, telemetry_type::vec3, payload);
+  }
+
+  /**
+   * @brief Encode and write one unsigned integer record
+   *
+   * @param p_channel - stream identifier of the value
+   * @param p_value - value to record
+   * @return status - success or failure of the underlying serial write
+   */
+  [[nodiscard]] status write(hal::byte p_channel, std::uint32_t p_value)
+  {
+    return write_record(p_channel, telemetry_type::u32, as_payload(p_value));
+  }
+
+  /**
+   * @brief Encode and write one opaque byte record
+   *
+   * @param p_channel - stream identifier of the buffer
+   * @param p_bytes - bytes to record, at most 255 of them
+   * @return status - success or failure of the underlying serial write
+   * @throws std::errc::invalid_argument - if the buffer exceeds the 255
+   * byte payload limit of the record length field.
+   */
+  [[nodiscard]] status write(hal::byte p_channel,
+                             std::span<const hal::byte> p_bytes)
+  {
+    if (p_bytes.size() > max_payload_size) {
+      return hal::new_error(std::errc::invalid_argument);
+    }
+    return write_record(p_channel, telemetry_type::bytes, p_bytes);
+  }
+
+private:
+  static constexpr hal::byte sync_byte = 0xA5;
+  static constexpr size_t header_size = 12;
+  static constexpr size_t max_payload_size = 255;
+
+  static constexpr std::array<hal::byte, 4> as_payload(std::uint32_t p_value)
+  {
+    return std::array<hal::byte, 4>{
+      static_cast<hal::byte>(p_value),
+      static_cast<hal::byte>(p_value >> 8),
+      static_cast<hal::byte>(p_value >> 16),
+      static_cast<hal::byte>(p_value >> 24),
+    };
+  }
+
+  status write_record(hal::byte p_channel,
+                      telemetry_type p_type,
+                      std::span<const hal::byte> p_payload)
+  {
+    std::array<hal::byte, header_size + max_payload_size + 1> record{};
+    record[0] = sync_byte;
+    record[1] = p_channel;
+    record[2] = static_cast<hal::byte>(p_type);
+    record[3] = static_cast<hal::byte>(p_payload.size());
+    auto timestamp = m_clock->uptime().ticks;
+    for (size_t index = 0; index < 8; index++) {
+      record[4 + index] = static_cast<hal::byte>(timestamp >> (8 * index));
+    }
+    if (!p_payload.empty()) {
+      std::memcpy(&record[header_size], p_payload.data(), p_payload.size());
+    }
+    auto record_size = header_size + p_payload.size();
+    std::uint8_t sum = 0;
+    for (size_t index = 0; index < record_size; index++) {
+      sum = static_cast<std::uint8_t>(sum + record[index]);
+    }
+    record[record_size] = static_cast<hal::byte>(-sum);
+    auto view = std::span<const hal::byte>(record).first(record_size + 1);
+    while (!view.empty()) {
+      auto write_result = HAL_CHECK(m_serial->write(view));
+      view = view.subspan(write_result.data.size());
+    }
+    return hal::success();
+  }
+
+  hal::serial* m_serial;
+  hal::steady_clock* m_clock;
+};
+}  // namespace hal
@@ -15,6 +15,7 @@
 #pragma once
 
 #include "error.hpp"
+#include "sampling.hpp"
 #include "units.hpp"
 
 namespace hal {
@@ -39,6 +40,28 @@ public:
     celsius temperature;
   };
 
+  /**
+   * @brief Negotiate the device's conversion rate and resolution
+   *
+   * Many temperature sensors trade conversion time for resolution. The
+   * caller states the ranges it can accept and the driver applies the
+   * nearest conversion configuration the device supports, reporting what
+   * was actually achieved. Implementing drivers must verify achievability
+   * before modifying the device, so a failed call leaves it unchanged.
+   *
+   * @param p_settings - acceptable sample rate and resolution ranges
+   * @return result<sampling_t> - the achieved operating point
+   * @throws std::errc::not_supported - if the device's operating point is
+   * fixed at initialization and cannot be renegotiated.
+   * @throws std::errc::invalid_argument - if no supported operating point
+   * falls within the requested ranges.
+   */
+  [[nodiscard]] result<sampling_t> configure(
+    const sampling_settings& p_settings)
+  {
+    return driver_configure(p_settings);
+  }
+
   /**
    * @brief Read the current temperature measured by the device
    *
@@ -53,5 +76,11 @@ public:
 
 private:
   virtual result<read_t> driver_read() = 0;
+  virtual result<sampling_t> driver_configure(
+    const sampling_settings& p_settings)
+  {
+    (void)p_settings;
+    return hal::new_error(std::errc::not_supported);
+  }
 };
 }  // namespace hal
@@ -21,8 +21,12 @@
  */
 #pragma once
 
+#include <cstdint>
+
 #include "error.hpp"
 #include "functional.hpp"
+#include "steady_clock.hpp"
+#include "units.hpp"
 
 namespace hal {
 /**
@@ -78,6 +82,64 @@ using work_function = result<work_state>();
 template<class T>
 concept worker = std::convertible_to<T, hal::function_ref<work_function>>;
 
+/**
+ * @ingroup TimeoutCore
+ * @brief Timeout object with a precomputed absolute tick deadline
+ *
+ * Typical steady_clock based timeout callables convert the clock frequency
+ * and the remaining duration with floating point math on every poll. This
+ * type performs that conversion exactly once, at construction, by computing
+ * the absolute 64-bit tick count at which the timeout expires. Each
+ * subsequent check is a single integer comparison against `uptime()`, which
+ * matters for busy-wait loops that poll millions of times.
+ *
+ * Satisfies the hal::timeout concept and can be passed anywhere a
+ * `hal::timeout_function` is accepted, including hal::delay().
+ */
+class deadline
+{
+public:
+  /**
+   * @brief Construct a deadline from a clock and a duration
+   *
+   * @param p_clock - steady clock used to measure the passage of time. Must
+   * outlive this object.
+   * @param p_duration - time from now after which the deadline expires.
+   * Negative durations expire immediately.
+   */
+  deadline(hal::steady_clock& p_clock, hal::time_duration p_duration)
+    : m_clock(&p_clock)
+  {
+    constexpr float nanoseconds_per_second = 1'000'000'000.0f;
+    auto ticks_per_nanosecond =
+      p_clock.frequency().operating_frequency / nanoseconds_per_second;
+    auto duration_count = p_duration < hal::time_duration::zero()
+                            ? std::int64_t{ 0 }
+                            : p_duration.count();
+    auto delay_ticks = static_cast<std::uint64_t>(
+      static_cast<float>(duration_count) * ticks_per_nanosecond);
+    m_deadline = p_clock.uptime().ticks + delay_ticks;
+  }
+
+  /**
+   * @brief Check if the deadline has been reached
+   *
+   * @return status - success if the deadline has not yet been reached
+   * @throws std::errc::timed_out - when the deadline has been reached.
+   */
+  status operator()()
+  {
+    if (m_clock->uptime().ticks >= m_deadline) {
+      return hal::new_error(std::errc::timed_out);
+    }
+    return hal::success();
+  }
+
+private:
+  hal::steady_clock* m_clock;
+  std::uint64_t m_deadline;
+};
+
 /**
  * @ingroup TimeoutCore
  * @brief Delay the execution of the application or thread for a duration of
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 
 #include "error.hpp"
 #include "functional.hpp"
@@ -87,6 +88,37 @@ public:
   struct schedule_t
   {};
 
+  /**
+   * @brief Result from requesting the timer's tick period
+   *
+   */
+  struct tick_period_t
+  {
+    /**
+     * @brief Duration of a single timer tick
+     *
+     * Constant for the life of the timer. Guaranteed by the implementing
+     * driver to be a positive, non-zero duration.
+     */
+    std::chrono::nanoseconds period;
+  };
+
+  /**
+   * @brief Get the duration of a single tick of this timer
+   *
+   * Query this once and convert delays to ticks ahead of time, then
+   * schedule with the tick-native APIs to skip per-call duration
+   * conversion.
+   *
+   * @return result<tick_period_t> - the timer's tick period
+   * @throws std::errc::not_supported - if the driver predates the
+   * tick-native APIs and does not report its tick period.
+   */
+  [[nodiscard]] result<tick_period_t> tick_period()
+  {
+    return driver_tick_period();
+  }
+
   /**
    * @brief Determine if the timer is currently running
    *
@@ -141,6 +173,84 @@ public:
     return driver_schedule(p_callback, p_delay);
   }
 
+  /**
+   * @brief Schedule a callback to be executed repeatedly at a fixed period
+   *
+   * Unlike re-arming a one-shot schedule from inside the callback, the period
+   * is reloaded by hardware, so no rescheduling work happens between
+   * expirations and no drift accumulates from callback latency. The callback
+   * runs after every elapsed period until `cancel()` is called or a new event
+   * is scheduled.
+   *
+   * The period is quantized to timer ticks following the same rules as
+   * `schedule()`. If this is called and the timer has already scheduled an
+   * event, then the previous scheduled event will be canceled and the new
+   * scheduled event will be started.
+   *
+   * @param p_callback - callback function to be called each time the period
+   * elapses
+   * @param p_period - the amount of time between executions of the callback
+   * @return result<schedule_t> - success or failure
+   * @throws out_of_bounds_error - if p_period is greater than what can be
+   * achieved
+   * @throws std::errc::not_supported - if the timer hardware cannot reload
+   * the period automatically
+   */
+  [[nodiscard]] result<schedule_t> schedule_repeating(
+    hal::callback<void(void)> p_callback,
+    hal::time_duration p_period)
+  {
+    return driver_schedule_repeating(p_callback, p_period);
+  }
+
+  /**
+   * @brief Schedule a callback a number of timer ticks in the future
+   *
+   * Equivalent to `schedule()` with a delay of `tick_period() * p_ticks`,
+   * minus the per-call conversion from nanoseconds to ticks: callers that
+   * reschedule at high rates, such as motor commutation loops, convert
+   * their delay to ticks once and implementations load the compare
+   * register with the value as given. A tick count of zero follows the
+   * same rules as a zero-tick delay in `schedule()` and expires after one
+   * tick period.
+   *
+   * @param p_callback - callback function to be called when the timer
+   * expires
+   * @param p_ticks - number of timer ticks until the timer expires
+   * @return result<schedule_t> - success or failure
+   * @throws out_of_bounds_error - if p_ticks is greater than what can be
+   * achieved
+   */
+  [[nodiscard]] result<schedule_t> schedule_ticks(
+    hal::callback<void(void)> p_callback,
+    std::uint32_t p_ticks)
+  {
+    return driver_schedule_ticks(p_callback, p_ticks);
+  }
+
+  /**
+   * @brief Schedule a repeating callback with a period in timer ticks
+   *
+   * The tick-native form of `schedule_repeating()`, following its reload
+   * and cancellation rules.
+   *
+   * @param p_callback - callback function to be called each time the
+   * period elapses
+   * @param p_ticks - number of timer ticks between executions of the
+   * callback
+   * @return result<schedule_t> - success or failure
+   * @throws out_of_bounds_error - if p_ticks is greater than what can be
+   * achieved
+   * @throws std::errc::not_supported - if the timer hardware cannot reload
+   * the period automatically
+   */
+  [[nodiscard]] result<schedule_t> schedule_repeating_ticks(
+    hal::callback<void(void)> p_callback,
+    std::uint32_t p_ticks)
+  {
+    return driver_schedule_repeating_ticks(p_callback, p_ticks);
+  }
+
   virtual ~timer() = default;
 
 private:
@@ -149,5 +259,31 @@ private:
   virtual result<schedule_t> driver_schedule(
     hal::callback<void(void)> p_callback,
     hal::time_duration p_delay) = 0;
+  virtual result<schedule_t> driver_schedule_repeating(
+    hal::callback<void(void)> p_callback,
+    hal::time_duration p_period)
+  {
+    (void)p_callback;
+    (void)p_period;
+    return hal::new_error(std::errc::not_supported);
+  }
+  virtual result<tick_period_t> driver_tick_period()
+  {
+    return hal::new_error(std::errc::not_supported);
+  }
+  virtual result<schedule_t> driver_schedule_ticks(
+    hal::callback<void(void)> p_callback,
+    std::uint32_t p_ticks)
+  {
+    auto period = HAL_CHECK(driver_tick_period()).period;
+    return driver_schedule(p_callback, period * p_ticks);
+  }
+  virtual result<schedule_t> driver_schedule_repeating_ticks(
+    hal::callback<void(void)> p_callback,
+    std::uint32_t p_ticks)
+  {
+    auto period = HAL_CHECK(driver_tick_period()).period;
+    return driver_schedule_repeating(p_callback, period * p_ticks);
+  }
 };
 }  // namespace hal
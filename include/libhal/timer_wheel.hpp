@@ -0,0 +1,228 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @defgroup TimerWheel Timer Wheel
+ * @file timer_wheel.hpp
+ * @brief Multiplex many software timeouts onto a single hal::timer.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "error.hpp"
+#include "functional.hpp"
+#include "steady_clock.hpp"
+#include "timer.hpp"
+#include "units.hpp"
+
+namespace hal {
+/**
+ * @ingroup TimerWheel
+ * @brief Software timer multiplexer backed by a single hardware timer
+ *
+ * Platforms rarely provide more than a handful of hardware timers, while
+ * applications commonly track tens of concurrent timeouts such as protocol
+ * retransmissions and sensor watchdogs. This utility multiplexes up to
+ * Capacity logical one-shot timers onto one hal::timer. The hardware timer is
+ * always armed for the earliest pending deadline; when it expires, due
+ * callbacks are executed and the hardware is re-armed once for the next
+ * deadline. Scheduling and cancelling are constant time operations backed by
+ * a free list; only the expiration of the hardware timer walks the entry
+ * table.
+ *
+ * Logical timer callbacks are executed in the execution context of the
+ * underlying hal::timer's callback, typically an interrupt, and must follow
+ * the same restrictions. Scheduling a new logical timer from within an
+ * expired callback is supported. This class is not safe to use concurrently
+ * from multiple execution contexts.
+ *
+ * @tparam Capacity - maximum number of concurrently scheduled logical timers
+ */
+template<size_t Capacity>
+class timer_wheel
+{
+public:
+  static_assert(Capacity > 0, "timer_wheel capacity must be at least 1");
+
+  /**
+   * @brief Feedback from scheduling a logical timer
+   *
+   */
+  struct schedule_t
+  {
+    /**
+     * @brief Identifier used to cancel the logical timer before it expires
+     *
+     * Identifiers are recycled once the logical timer expires or is
+     * cancelled.
+     */
+    size_t id;
+  };
+
+  /**
+   * @brief Construct a timer wheel on top of a hardware timer
+   *
+   * The timer wheel takes over the hardware timer. Scheduling events on the
+   * hardware timer directly while the wheel is in use results in lost
+   * logical timer expirations.
+   *
+   * Deadlines are anchored to the steady clock's uptime, so re-arming the
+   * hardware timer from a mid-flight schedule() or cancel() accounts for
+   * the time that already passed since the previous arm.
+   *
+   * @param p_timer - hardware timer to multiplex. Must outlive this object.
+   * @param p_clock - steady clock used to anchor deadlines to real elapsed
+   * time. Must outlive this object.
+   */
+  timer_wheel(hal::timer& p_timer, hal::steady_clock& p_clock)
+    : m_timer(&p_timer)
+    , m_clock(&p_clock)
+  {
+    constexpr float nanoseconds_per_second = 1'000'000'000.0f;
+    m_nanoseconds_per_tick =
+      nanoseconds_per_second / p_clock.frequency().operating_frequency;
+    for (size_t index = 0; index < Capacity; index++) {
+      m_entries[index].next_free = index + 1;
+    }
+  }
+
+  /**
+   * @brief Schedule a callback to be executed after the delay time
+   *
+   * @param p_callback - callback function to be called when the delay has
+   * elapsed
+   * @param p_delay - the amount of time until the callback is executed
+   * @return result<schedule_t> - identifier for cancellation
+   * @throws std::errc::not_enough_memory - if Capacity logical timers are
+   * already scheduled.
+   * @throws out_of_bounds_error - propagated from the underlying timer if
+   * the delay cannot be achieved.
+   */
+  [[nodiscard]] result<schedule_t> schedule(hal::callback<void(void)> p_callback,
+                                            hal::time_duration p_delay)
+  {
+    if (m_free == Capacity) {
+      return hal::new_error(std::errc::not_enough_memory);
+    }
+    auto current = now();
+    size_t id = m_free;
+    entry& slot = m_entries[id];
+    m_free = slot.next_free;
+    slot.callback = p_callback;
+    slot.deadline = current + p_delay;
+    slot.active = true;
+    HAL_CHECK(arm(current));
+    return schedule_t{ .id = id };
+  }
+
+  /**
+   * @brief Stop a scheduled logical timer from expiring
+   *
+   * Does nothing if the identifier does not refer to a scheduled logical
+   * timer, which happens when its callback has already been executed.
+   *
+   * @param p_id - identifier returned by schedule()
+   * @return status - success or failure
+   * @throws std::errc::invalid_argument - if the identifier was never
+   * returned by schedule().
+   */
+  [[nodiscard]] status cancel(size_t p_id)
+  {
+    if (p_id >= Capacity) {
+      return hal::new_error(std::errc::invalid_argument);
+    }
+    if (m_entries[p_id].active) {
+      release(p_id);
+      HAL_CHECK(arm(now()));
+    }
+    return hal::success();
+  }
+
+private:
+  struct entry
+  {
+    hal::callback<void(void)> callback = []() {};
+    hal::time_duration deadline{};
+    size_t next_free = 0;
+    bool active = false;
+  };
+
+  void release(size_t p_id)
+  {
+    m_entries[p_id].active = false;
+    m_entries[p_id].next_free = m_free;
+    m_free = p_id;
+  }
+
+  // Steady clock uptime expressed as a duration, anchoring all deadlines
+  hal::time_duration now()
+  {
+    auto ticks = m_clock->uptime().ticks;
+    return hal::time_duration(static_cast<std::int64_t>(
+      static_cast<float>(ticks) * m_nanoseconds_per_tick));
+  }
+
+  // Arm the hardware timer for the earliest active deadline, if any
+  status arm(hal::time_duration p_now)
+  {
+    constexpr auto none = hal::time_duration::max();
+    auto earliest = none;
+    for (const entry& slot : m_entries) {
+      if (slot.active && slot.deadline < earliest) {
+        earliest = slot.deadline;
+      }
+    }
+    if (earliest == none) {
+      HAL_CHECK(m_timer->cancel());
+      return hal::success();
+    }
+    auto delay = earliest - p_now;
+    if (delay < hal::time_duration::zero()) {
+      delay = hal::time_duration::zero();
+    }
+    HAL_CHECK(m_timer->schedule([this]() { expire(); }, delay));
+    return hal::success();
+  }
+
+  // Hardware timer expired: run due callbacks, re-arm for the next deadline
+  void expire()
+  {
+    auto current = now();
+    for (size_t id = 0; id < Capacity; id++) {
+      entry& slot = m_entries[id];
+      if (slot.active && slot.deadline <= current) {
+        auto callback = slot.callback;
+        // Free the slot before invoking so the callback can schedule anew
+        release(id);
+        callback();
+      }
+    }
+    // Expiration happens in the timer callback context where errors cannot
+    // be returned to a caller. A failure to re-arm here stops the wheel; the
+    // next schedule() or cancel() call will surface hardware errors again.
+    // Time is re-read so the delay excludes what the callbacks consumed.
+    (void)arm(now());
+  }
+
+  hal::timer* m_timer;
+  hal::steady_clock* m_clock;
+  std::array<entry, Capacity> m_entries{};
+  float m_nanoseconds_per_tick;
+  size_t m_free = 0;
+};
+}  // namespace hal
@@ -16,6 +16,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <limits>
 
 #include "error.hpp"
 
@@ -61,6 +62,56 @@ using degrees = float;
 /// Type for magnetic field represented in gauss.
 using gauss = float;
 
+/**
+ * @brief Fixed point Q1.31 ratio type for platforms without an FPU
+ *
+ * Represents a ratio in the range [-1.0, 1.0) with 31 fractional bits. Use
+ * this in place of the float ratio parameters of hot interface calls, such as
+ * pwm::duty_cycle() and dac::write(), to keep the entire path in integer
+ * arithmetic on processors where a single soft-float operation costs hundreds
+ * of cycles. A ratio of exactly 1.0 is represented by the maximum raw value,
+ * one least significant bit below 1.0.
+ */
+struct q31
+{
+  /// Raw two's complement fixed point value with 31 fractional bits
+  std::int32_t raw = 0;
+
+  /**
+   * @brief Convert a float ratio into a q31, clamping to [-1.0, 1.0)
+   *
+   * This conversion is constexpr so ratios known at compile time, including
+   * the unit literals, cost nothing at runtime.
+   *
+   * @param p_value - ratio to convert
+   * @return q31 - the nearest representable fixed point ratio
+   */
+  [[nodiscard]] static constexpr q31 from_float(float p_value) noexcept
+  {
+    constexpr float scale = 2147483648.0f;  // 2^31
+    if (p_value >= 1.0f) {
+      return q31{ std::numeric_limits<std::int32_t>::max() };
+    }
+    if (p_value <= -1.0f) {
+      return q31{ std::numeric_limits<std::int32_t>::min() };
+    }
+    return q31{ static_cast<std::int32_t>(p_value * scale) };
+  }
+
+  /**
+   * @brief Convert this fixed point ratio into a float
+   *
+   * @return float - the ratio as a floating point value
+   */
+  [[nodiscard]] constexpr float to_float() const noexcept
+  {
+    constexpr float scale = 2147483648.0f;  // 2^31
+    return static_cast<float>(raw) / scale;
+  }
+
+  constexpr auto operator<=>(const q31&) const noexcept = default;
+};
+
 /**
  * @brief Set of possible pin mode resistor settings.
  *
@@ -253,9 +304,80 @@ namespace literals {
   constexpr long double miles_to_meter = 1609.344L;
   return static_cast<float>(p_value * miles_to_meter);
 }
+
+// =============================================================================
+// Fixed point ratio
+// =============================================================================
+
+[[nodiscard]] consteval q31 operator""_q31(long double p_value) noexcept
+{
+  return q31::from_float(static_cast<float>(p_value));
+}
 }  // namespace literals
 
 // Make user defined namespaces available to any library within the hal
 // namespace
 using namespace literals;
+
+// =============================================================================
+// Integer tick/duration conversion
+// =============================================================================
+
+/**
+ * @brief Convert a duration to steady clock ticks with integer arithmetic
+ *
+ * Unlike conversions through float hertz, this is exact for any integer
+ * frequency: whole seconds of the duration multiply the frequency directly
+ * and only the sub-second remainder takes a truncating division. constexpr,
+ * so conversions against a frequency known at build time fold to a
+ * constant:
+ *
+ *     constexpr auto ticks = hal::duration_to_ticks(96'000'000, 1ms);
+ *
+ * @param p_frequency_hz - clock frequency in integer hertz
+ * @param p_duration - duration to convert. Negative durations convert to
+ * zero ticks.
+ * @return std::uint64_t - number of ticks spanning the duration, rounded
+ * down
+ */
+[[nodiscard]] constexpr std::uint64_t duration_to_ticks(
+  std::uint32_t p_frequency_hz,
+  time_duration p_duration) noexcept
+{
+  if (p_duration < time_duration::zero()) {
+    return 0;
+  }
+  constexpr std::uint64_t nanoseconds_per_second = 1'000'000'000;
+  auto nanoseconds = static_cast<std::uint64_t>(p_duration.count());
+  std::uint64_t seconds = nanoseconds / nanoseconds_per_second;
+  std::uint64_t remainder = nanoseconds % nanoseconds_per_second;
+  // remainder and frequency each fit in 32 bits plus change, so this
+  // product cannot overflow 64 bits
+  return (seconds * p_frequency_hz) +
+         (remainder * p_frequency_hz) / nanoseconds_per_second;
+}
+
+/**
+ * @brief Convert steady clock ticks to a duration with integer arithmetic
+ *
+ * Inverse of duration_to_ticks() with the same exactness and constexpr
+ * properties.
+ *
+ * @param p_frequency_hz - clock frequency in integer hertz
+ * @param p_ticks - number of ticks to convert
+ * @return time_duration - duration spanned by the ticks, rounded down to
+ * the nanosecond
+ */
+[[nodiscard]] constexpr time_duration ticks_to_duration(
+  std::uint32_t p_frequency_hz,
+  std::uint64_t p_ticks) noexcept
+{
+  constexpr std::uint64_t nanoseconds_per_second = 1'000'000'000;
+  std::uint64_t seconds = p_ticks / p_frequency_hz;
+  std::uint64_t remainder = p_ticks % p_frequency_hz;
+  return time_duration(
+    static_cast<time_duration::rep>((seconds * nanoseconds_per_second) +
+                                    (remainder * nanoseconds_per_second) /
+                                      p_frequency_hz));
+}
 }  // namespace hal
@@ -0,0 +1,135 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @defgroup Vec3 Vec3
+ * @file vec3.hpp
+ * @brief Provides the hal::vec3 three-axis sample type.
+ */
+#pragma once
+
+namespace hal {
+/**
+ * @ingroup Vec3
+ * @brief Three-axis sample type shared by the x/y/z sensor interfaces
+ *
+ * Used as the result type of the accelerometer, gyroscope and magnetometer
+ * interfaces so that sensor-fusion code operates on one layout rather than
+ * converting between per-interface structs. The type is aligned to 16 bytes,
+ * the width of a full struct load, so arrays of samples can be loaded with
+ * aligned vector or paired floating point instructions.
+ *
+ * The unit of the axis values depends on the interface that produced the
+ * sample.
+ */
+struct alignas(16) vec3
+{
+  /**
+   * @brief Sample value along the X axis, relative to the device's reference
+   * frame.
+   *
+   */
+  float x;
+  /**
+   * @brief Sample value along the Y axis, relative to the device's reference
+   * frame.
+   *
+   */
+  float y;
+  /**
+   * @brief Sample value along the Z axis, relative to the device's reference
+   * frame.
+   *
+   */
+  float z;
+
+  constexpr vec3& operator+=(const vec3& p_other) noexcept
+  {
+    x += p_other.x;
+    y += p_other.y;
+    z += p_other.z;
+    return *this;
+  }
+
+  constexpr vec3& operator-=(const vec3& p_other) noexcept
+  {
+    x -= p_other.x;
+    y -= p_other.y;
+    z -= p_other.z;
+    return *this;
+  }
+
+  constexpr vec3& operator*=(float p_scale) noexcept
+  {
+    x *= p_scale;
+    y *= p_scale;
+    z *= p_scale;
+    return *this;
+  }
+
+  constexpr vec3& operator/=(float p_scale) noexcept
+  {
+    x /= p_scale;
+    y /= p_scale;
+    z /= p_scale;
+    return *this;
+  }
+
+  [[nodiscard]] constexpr friend vec3 operator+(vec3 p_lhs,
+                                                const vec3& p_rhs) noexcept
+  {
+    return p_lhs += p_rhs;
+  }
+
+  [[nodiscard]] constexpr friend vec3 operator-(vec3 p_lhs,
+                                                const vec3& p_rhs) noexcept
+  {
+    return p_lhs -= p_rhs;
+  }
+
+  [[nodiscard]] constexpr friend vec3 operator*(vec3 p_lhs,
+                                                float p_scale) noexcept
+  {
+    return p_lhs *= p_scale;
+  }
+
+  [[nodiscard]] constexpr friend vec3 operator*(float p_scale,
+                                                vec3 p_rhs) noexcept
+  {
+    return p_rhs *= p_scale;
+  }
+
+  [[nodiscard]] constexpr friend vec3 operator/(vec3 p_lhs,
+                                                float p_scale) noexcept
+  {
+    return p_lhs /= p_scale;
+  }
+
+  [[nodiscard]] constexpr friend bool operator==(const vec3& p_lhs,
+                                                 const vec3& p_rhs) noexcept
+  {
+    return p_lhs.x == p_rhs.x && p_lhs.y == p_rhs.y && p_lhs.z == p_rhs.z;
+  }
+
+  /**
+   * @brief Compute the dot product of two samples
+   *
+   */
+  [[nodiscard]] constexpr friend float dot(const vec3& p_lhs,
+                                           const vec3& p_rhs) noexcept
+  {
+    return p_lhs.x * p_rhs.x + p_lhs.y * p_rhs.y + p_lhs.z * p_rhs.z;
+  }
+};
+}  // namespace hal
@@ -37,6 +37,56 @@ private:
     return read_t{ .sample = m_returned_position };
   }
 };
+
+class test_streaming_adc : public test_adc
+{
+public:
+  std::span<uint16_t> m_buffer{};
+  bool m_stopped{ false };
+
+  ~test_streaming_adc() override = default;
+
+private:
+  result<stream_t> driver_stream(
+    std::span<uint16_t> p_buffer,
+    hertz p_sample_rate,
+    hal::callback<stream_handler> p_handler) override
+  {
+    m_buffer = p_buffer;
+    // Simulate the first half of the ring buffer completing
+    p_handler(p_buffer.first(p_buffer.size() / 2));
+    return stream_t{ .sample_rate = p_sample_rate, .bits = 12 };
+  }
+
+  status driver_stop() override
+  {
+    m_stopped = true;
+    return success();
+  }
+};
+
+class test_configurable_adc : public test_adc
+{
+public:
+  // Simulates hardware with a 10 kHz to 1 MHz clock range and 12-bit samples
+  constexpr static auto m_min_rate = 10.0_kHz;
+  constexpr static auto m_max_rate = 1.0_MHz;
+
+  ~test_configurable_adc() override = default;
+
+private:
+  result<sampling_t> driver_configure(
+    const sampling_settings& p_settings) override
+  {
+    if (p_settings.min_sample_rate > m_max_rate ||
+        p_settings.max_sample_rate < m_min_rate || p_settings.min_bits > 12 ||
+        p_settings.max_bits < 12) {
+      return hal::new_error(std::errc::invalid_argument);
+    }
+    auto rate = std::clamp(p_settings.max_sample_rate, m_min_rate, m_max_rate);
+    return sampling_t{ .sample_rate = rate, .bits = 12 };
+  }
+};
 }  // namespace
 
 void adc_test()
@@ -54,16 +104,107 @@ void adc_test()
     expect(that % expected_value == result.value().sample);
   };
 
+  "adc burst read test"_test = []() {
+    // Setup
+    test_adc test;
+    std::array<uint16_t, 4> samples{};
+    // The default burst implementation scales the 0.5f sample to 16 bits
+    constexpr uint16_t expected_sample = 0x7FFF;
+
+    // Exercise
+    auto result = test.read(samples);
+
+    // Verify
+    expect(bool{ result });
+    expect(that % samples.data() == result.value().data.data());
+    expect(that % samples.size() == result.value().data.size());
+    expect(that % 16 == result.value().bits);
+    expect(that % expected_sample == samples[0]);
+    expect(that % expected_sample == samples[3]);
+  };
+
+  "adc stream test"_test = []() {
+    // Setup
+    test_streaming_adc test;
+    std::array<uint16_t, 8> ring_buffer{};
+    std::span<uint16_t> delivered{};
+
+    // Exercise
+    auto result = test.stream(
+      ring_buffer, 100.0_kHz, [&delivered](std::span<uint16_t> p_samples) {
+        delivered = p_samples;
+      });
+    auto stop_result = test.stop();
+
+    // Verify
+    expect(bool{ result });
+    expect(bool{ stop_result });
+    expect(that % 12 == result.value().bits);
+    expect(that % ring_buffer.data() == delivered.data());
+    expect(that % (ring_buffer.size() / 2) == delivered.size());
+    expect(that % true == test.m_stopped);
+  };
+
+  "adc stream default unsupported test"_test = []() {
+    // Setup
+    test_adc test;
+    std::array<uint16_t, 8> ring_buffer{};
+
+    // Exercise
+    auto result =
+      test.stream(ring_buffer, 100.0_kHz, [](std::span<uint16_t>) {});
+    auto stop_result = test.stop();
+
+    // Verify
+    expect(!bool{ result });
+    expect(!bool{ stop_result });
+  };
+
+  "adc configure negotiation test"_test = []() {
+    // Setup
+    test_configurable_adc test;
+
+    // Exercise
+    // Asks for at least 2 MHz: the hardware tops out at 1 MHz
+    auto too_fast =
+      test.configure(sampling_settings{ .min_sample_rate = 2.0_MHz });
+    // Accepts anything up to 100 kHz at 8 bits or better
+    auto achieved = test.configure(sampling_settings{
+      .max_sample_rate = 100.0_kHz,
+      .min_bits = 8,
+    });
+
+    // Verify
+    expect(!bool{ too_fast });
+    expect(bool{ achieved });
+    expect(that % 100'000.0f == achieved.value().sample_rate);
+    expect(that % 12 == achieved.value().bits);
+  };
+
+  "adc configure default unsupported test"_test = []() {
+    // Setup
+    test_adc test;
+
+    // Exercise
+    auto result = test.configure(sampling_settings{});
+
+    // Verify
+    expect(!bool{ result });
+  };
+
   "adc errors test"_test = []() {
     // Setup
     test_adc test;
     test.m_return_error_status = true;
+    std::array<uint16_t, 4> samples{};
 
     // Exercise
     auto result = test.read();
+    auto burst_result = test.read(samples);
 
     // Verify
     expect(!bool{ result });
+    expect(!bool{ burst_result });
   };
 }
 }  // namespace hal
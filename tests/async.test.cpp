@@ -0,0 +1,102 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/async.hpp>
+
+#include <array>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+class fake_steady_clock : public hal::steady_clock
+{
+public:
+  std::uint64_t m_ticks{ 0 };
+
+private:
+  frequency_t driver_frequency() override
+  {
+    return frequency_t{ .operating_frequency = 1'000'000.0f };
+  };
+  uptime_t driver_uptime() override
+  {
+    return uptime_t{ .ticks = m_ticks };
+  };
+};
+
+class test_i2c : public hal::i2c
+{
+public:
+  hal::byte m_address{};
+
+  ~test_i2c() override = default;
+
+private:
+  status driver_configure(const settings&) override
+  {
+    return success();
+  };
+  result<transaction_t> driver_transaction(
+    hal::byte p_address,
+    [[maybe_unused]] std::span<const hal::byte> p_data_out,
+    [[maybe_unused]] std::span<hal::byte> p_data_in,
+    [[maybe_unused]] hal::function_ref<hal::timeout_function> p_timeout)
+    override
+  {
+    m_address = p_address;
+    return transaction_t{};
+  };
+};
+}  // namespace
+
+void async_test()
+{
+  using namespace boost::ut;
+  "async_transaction test"_test = []() {
+    // Setup
+    test_i2c test;
+    constexpr std::array<hal::byte, 2> payload{ 0x01, 0x02 };
+
+    // Exercise
+    // The default transaction_async worker performs the blocking transfer
+    // on its first poll, so the task finishes on its first poll as well.
+    auto work = async_transaction(test, 0x17, payload, {});
+    auto poll = work();
+
+    // Verify
+    expect(work_state::finished == poll.value());
+    expect(that % hal::byte{ 0x17 } == test.m_address);
+  };
+
+  "async_delay test"_test = []() {
+    // Setup
+    fake_steady_clock clock;
+    // 10us at 1MHz is 10 ticks
+    auto work = async_delay(clock, std::chrono::microseconds(10));
+
+    // Exercise
+    auto poll1 = work();
+    clock.m_ticks = 5;
+    auto poll2 = work();
+    clock.m_ticks = 10;
+    auto poll3 = work();
+
+    // Verify
+    expect(work_state::in_progress == poll1.value());
+    expect(work_state::in_progress == poll2.value());
+    expect(work_state::finished == poll3.value());
+  };
+};
+}  // namespace hal
@@ -0,0 +1,102 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/bit.hpp>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+// A register map described once with constexpr fields
+struct control_reg
+{
+  static constexpr auto duty = bit_mask::from(0, 15);
+  static constexpr auto prescale = bit_mask::from(16, 23);
+  static constexpr auto mode = bit_mask::from(24, 25);
+  static constexpr auto enable = bit_mask::from(31);
+};
+}  // namespace
+
+void bit_test()
+{
+  using namespace boost::ut;
+
+  "bit mask description test"_test = []() {
+    // Verify
+    static_assert(control_reg::duty.value<std::uint32_t>() == 0x0000'FFFF);
+    static_assert(control_reg::prescale.value<std::uint32_t>() == 0x00FF'0000);
+    static_assert(control_reg::enable.value<std::uint32_t>() == 0x8000'0000);
+    // Reversed bounds describe the same field
+    static_assert(bit_mask::from(23, 16).value<std::uint32_t>() ==
+                  0x00FF'0000);
+    // A full-width field saturates rather than overflowing the shift
+    static_assert(bit_mask::from(0, 31).value<std::uint32_t>() ==
+                  0xFFFF'FFFF);
+    static_assert(bit_mask::from(4).value<std::uint8_t>() == 0x10);
+  };
+
+  "bit extract test"_test = []() {
+    // Verify
+    static_assert(bit_extract(control_reg::prescale, 0x00AB'0000U) == 0xAB);
+    static_assert(bit_extract(control_reg::enable, 0x8000'0000U) == 1);
+    static_assert(bit_extract(control_reg::duty, 0xFFFF'1234U) == 0x1234);
+  };
+
+  "bit value composition test"_test = []() {
+    // Exercise
+    constexpr auto image = bit_value<std::uint32_t>()
+                             .insert(control_reg::duty, 0x1234)
+                             .insert(control_reg::prescale, 0xCD)
+                             .set(control_reg::enable)
+                             .get();
+
+    // Verify
+    static_assert(image == 0x80CD'1234);
+    // Inserting a too-wide value only touches the field's bits
+    static_assert(bit_value<std::uint32_t>()
+                    .insert(control_reg::mode, 0xFF)
+                    .get() == 0x0300'0000);
+  };
+
+  "bit modify single read-modify-write test"_test = []() {
+    // Setup
+    std::uint32_t fake_register = 0x8000'00FF;
+
+    // Exercise: several field updates commit as one read-modify-write
+    {
+      bit_modify(fake_register)
+        .insert(control_reg::duty, 0x4242)
+        .clear(control_reg::enable)
+        .toggle(control_reg::mode);
+    }
+
+    // Verify
+    expect(that % 0x0300'4242 == fake_register);
+  };
+
+  "bit set and clear register fast paths"_test = []() {
+    // Setup
+    std::uint32_t fake_set_register = 0;
+    std::uint32_t fake_clear_register = 0;
+
+    // Exercise
+    bit_set(fake_set_register, control_reg::enable);
+    bit_clear(fake_clear_register, control_reg::prescale);
+
+    // Verify: the mask is stored directly with no read-modify-write
+    expect(that % 0x8000'0000 == fake_set_register);
+    expect(that % 0x00FF'0000 == fake_clear_register);
+  };
+}
+}  // namespace hal
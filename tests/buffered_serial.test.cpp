@@ -0,0 +1,184 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/buffered_serial.hpp>
+
+#include "helpers.hpp"
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+std::vector<hal::byte> to_bytes(std::string_view p_text)
+{
+  return { p_text.begin(), p_text.end() };
+}
+}  // namespace
+
+void buffered_serial_test()
+{
+  using namespace boost::ut;
+  using namespace std::chrono_literals;
+
+  "buffered_serial combines small writes test"_test = []() {
+    // Setup
+    mock::steady_clock clock;
+    mock::serial wrapped;
+    buffered_serial<8> test(wrapped, clock, 1s);
+    auto first = to_bytes("log");
+    auto second = to_bytes("gin");
+
+    // Exercise
+    auto result1 = test.write(first);
+    auto result2 = test.write(second);
+
+    // Verify
+    expect(bool{ result1 });
+    expect(bool{ result2 });
+    expect(that % 0 == wrapped.m_write_calls);
+    expect(that % 6 == test.pending());
+  };
+
+  "buffered_serial flushes on full buffer test"_test = []() {
+    // Setup
+    mock::steady_clock clock;
+    mock::serial wrapped;
+    buffered_serial<8> test(wrapped, clock, 1s);
+    auto expected = to_bytes("loglines");
+
+    // Exercise
+    auto result1 = test.write(std::span(expected).first(4));
+    auto result2 = test.write(std::span(expected).last(4));
+
+    // Verify
+    expect(bool{ result1 });
+    expect(bool{ result2 });
+    expect(that % 1 == wrapped.m_write_calls);
+    expect(expected == wrapped.m_written);
+    expect(that % 0 == test.pending());
+  };
+
+  "buffered_serial drain test"_test = []() {
+    // Setup
+    mock::steady_clock clock;
+    mock::serial wrapped;
+    buffered_serial<8> test(wrapped, clock, 1s);
+    auto expected = to_bytes("hi");
+
+    // Exercise
+    auto write_result = test.write(expected);
+    auto drain_result = test.drain();
+
+    // Verify
+    expect(bool{ write_result });
+    expect(bool{ drain_result });
+    expect(that % 1 == wrapped.m_write_calls);
+    expect(expected == wrapped.m_written);
+    expect(that % 0 == test.pending());
+  };
+
+  "buffered_serial age flush via service test"_test = []() {
+    // Setup
+    mock::steady_clock clock;  // 1 MHz: 1000 ticks per microsecond
+    mock::serial wrapped;
+    buffered_serial<8> test(wrapped, clock, 1us);
+    auto expected = to_bytes("hi");
+
+    // Exercise
+    auto write_result = test.write(expected);
+    // Young buffer: service does nothing
+    auto young = test.service();
+    auto calls_while_young = wrapped.m_write_calls;
+    clock.advance(1000);
+    auto aged = test.service();
+
+    // Verify
+    expect(bool{ write_result });
+    expect(bool{ young });
+    expect(bool{ aged });
+    expect(that % 0 == calls_while_young);
+    expect(that % 1 == wrapped.m_write_calls);
+    expect(expected == wrapped.m_written);
+  };
+
+  "buffered_serial large write bypasses buffer test"_test = []() {
+    // Setup
+    mock::steady_clock clock;
+    mock::serial wrapped;
+    buffered_serial<8> test(wrapped, clock, 1s);
+    auto pending = to_bytes("hi");
+    auto large = to_bytes("0123456789");
+    auto expected = to_bytes("hi0123456789");
+
+    // Exercise
+    auto result1 = test.write(pending);
+    auto result2 = test.write(large);
+
+    // Verify: pending bytes drain first, preserving order
+    expect(bool{ result1 });
+    expect(bool{ result2 });
+    expect(that % 2 == wrapped.m_write_calls);
+    expect(expected == wrapped.m_written);
+    expect(that % 0 == test.pending());
+  };
+
+  "buffered_serial keeps bytes on failed drain test"_test = []() {
+    // Setup
+    mock::steady_clock clock;
+    mock::serial wrapped;
+    buffered_serial<8> test(wrapped, clock, 1s);
+    auto expected = to_bytes("hi");
+
+    // Exercise
+    auto write_result = test.write(expected);
+    wrapped.m_return_error_status = true;
+    auto failed_drain = test.drain();
+    auto pending_after_failure = test.pending();
+    wrapped.m_return_error_status = false;
+    auto retried_drain = test.drain();
+
+    // Verify
+    expect(bool{ write_result });
+    expect(!bool{ failed_drain });
+    expect(that % 2 == pending_after_failure);
+    expect(bool{ retried_drain });
+    expect(expected == wrapped.m_written);
+    expect(that % 0 == test.pending());
+  };
+
+  "buffered_serial forwards reads and configuration test"_test = []() {
+    // Setup
+    mock::steady_clock clock;
+    mock::serial wrapped;
+    wrapped.m_read_responses.push_back(to_bytes("ok"));
+    buffered_serial<8> test(wrapped, clock, 1s);
+    std::array<hal::byte, 4> buffer{};
+
+    // Exercise
+    auto configure_result =
+      test.configure(serial::settings{ .baud_rate = 9600.0f });
+    auto read_result = test.read(buffer);
+    auto flush_result = test.flush();
+
+    // Verify
+    expect(bool{ configure_result });
+    expect(that % 1 == wrapped.m_configure_calls);
+    expect(compare_floats(9600.0f, wrapped.m_settings.baud_rate));
+    expect(bool{ read_result });
+    expect(that % 2 == read_result.value().data.size());
+    expect(bool{ flush_result });
+    expect(that % 1 == wrapped.m_flush_calls);
+  };
+};
+}  // namespace hal
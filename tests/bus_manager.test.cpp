@@ -0,0 +1,270 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/bus_manager.hpp>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+class counting_i2c : public hal::i2c
+{
+public:
+  int m_configure_count{ 0 };
+  int m_transaction_count{ 0 };
+  bool m_return_error_status{ false };
+
+  ~counting_i2c() override = default;
+
+private:
+  status driver_configure([[maybe_unused]] const settings& p_settings) override
+  {
+    m_configure_count++;
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    return success();
+  };
+  result<transaction_t> driver_transaction(
+    [[maybe_unused]] hal::byte p_address,
+    [[maybe_unused]] std::span<const hal::byte> p_data_out,
+    [[maybe_unused]] std::span<hal::byte> p_data_in,
+    [[maybe_unused]] hal::function_ref<hal::timeout_function> p_timeout)
+    override
+  {
+    m_transaction_count++;
+    return transaction_t{};
+  };
+};
+
+class counting_spi : public hal::spi
+{
+public:
+  int m_configure_count{ 0 };
+  int m_transfer_count{ 0 };
+
+  ~counting_spi() override = default;
+
+private:
+  status driver_configure([[maybe_unused]] const settings& p_settings) override
+  {
+    m_configure_count++;
+    return success();
+  };
+  result<transfer_t> driver_transfer(
+    [[maybe_unused]] std::span<const hal::byte> p_data_out,
+    [[maybe_unused]] std::span<hal::byte> p_data_in,
+    [[maybe_unused]] hal::byte p_filler) override
+  {
+    m_transfer_count++;
+    return transfer_t{};
+  };
+};
+
+class recording_output_pin : public hal::output_pin
+{
+public:
+  int m_toggle_count{ 0 };
+  bool m_state{ true };
+
+  ~recording_output_pin() override = default;
+
+private:
+  status driver_configure([[maybe_unused]] const settings& p_settings) override
+  {
+    return success();
+  };
+  result<set_level_t> driver_level(bool p_high) override
+  {
+    if (p_high != m_state) {
+      m_toggle_count++;
+      m_state = p_high;
+    }
+    return set_level_t{};
+  };
+  result<level_t> driver_level() override
+  {
+    return level_t{ .state = m_state };
+  };
+};
+}  // namespace
+
+void bus_manager_test()
+{
+  using namespace boost::ut;
+  "i2c_bus_manager skips matching settings test"_test = []() {
+    // Setup
+    counting_i2c test;
+    i2c_bus_manager manager(test);
+
+    // Exercise
+    auto first = manager.configure({ .clock_rate = 100.0_kHz });
+    auto second = manager.configure({ .clock_rate = 100.0_kHz });
+    auto third = manager.configure({ .clock_rate = 1.0_MHz });
+    auto fourth = manager.configure({ .clock_rate = 100.0_kHz });
+
+    // Verify
+    expect(bool{ first });
+    expect(bool{ second });
+    expect(bool{ third });
+    expect(bool{ fourth });
+    expect(that % 3 == test.m_configure_count);
+  };
+
+  "i2c_bus_manager retries after failed configure test"_test = []() {
+    // Setup
+    counting_i2c test;
+    i2c_bus_manager manager(test);
+    test.m_return_error_status = true;
+
+    // Exercise
+    auto failed = manager.configure({ .clock_rate = 100.0_kHz });
+    test.m_return_error_status = false;
+    auto retried = manager.configure({ .clock_rate = 100.0_kHz });
+
+    // Verify
+    expect(!failed);
+    expect(bool{ retried });
+    expect(that % 2 == test.m_configure_count);
+  };
+
+  "i2c_bus_manager forwards transactions test"_test = []() {
+    // Setup
+    counting_i2c test;
+    i2c_bus_manager manager(test);
+
+    // Exercise
+    auto result = manager.transaction(0x11, {}, {}, hal::never_timeout());
+
+    // Verify
+    expect(bool{ result });
+    expect(that % 1 == test.m_transaction_count);
+  };
+
+  "spi_bus_manager skips matching settings test"_test = []() {
+    // Setup
+    counting_spi test;
+    spi_bus_manager manager(test);
+
+    // Exercise
+    auto first = manager.configure({ .clock_rate = 1.0_MHz });
+    auto second = manager.configure({ .clock_rate = 1.0_MHz });
+    auto third =
+      manager.configure({ .clock_rate = 1.0_MHz, .clock_idles_high = true });
+
+    // Verify
+    expect(bool{ first });
+    expect(bool{ second });
+    expect(bool{ third });
+    expect(that % 2 == test.m_configure_count);
+  };
+
+  "spi_device chip select per transfer test"_test = []() {
+    // Setup
+    counting_spi bus;
+    spi_device_manager manager(bus);
+    recording_output_pin chip_select;
+    spi_device device(manager, chip_select, { .clock_rate = 1.0_MHz });
+
+    // Exercise
+    auto first = device.transfer({}, {}, byte{ 0xFF });
+    auto second = device.transfer({}, {}, byte{ 0xFF });
+
+    // Verify
+    expect(bool{ first });
+    expect(bool{ second });
+    expect(that % 2 == bus.m_transfer_count);
+    // Asserted and deasserted once per transfer
+    expect(that % 4 == chip_select.m_toggle_count);
+    expect(that % true == chip_select.m_state);
+    // Settings applied once, not per transfer
+    expect(that % 1 == bus.m_configure_count);
+  };
+
+  "spi_device reconfigures only on device switch test"_test = []() {
+    // Setup
+    counting_spi bus;
+    spi_device_manager manager(bus);
+    recording_output_pin chip_select1;
+    recording_output_pin chip_select2;
+    spi_device device1(manager, chip_select1, { .clock_rate = 1.0_MHz });
+    spi_device device2(manager, chip_select2, { .clock_rate = 8.0_MHz });
+
+    // Exercise
+    auto first = device1.transfer({}, {}, byte{ 0xFF });
+    auto second = device1.transfer({}, {}, byte{ 0xFF });
+    auto third = device2.transfer({}, {}, byte{ 0xFF });
+    auto fourth = device1.transfer({}, {}, byte{ 0xFF });
+
+    // Verify
+    expect(bool{ first });
+    expect(bool{ second });
+    expect(bool{ third });
+    expect(bool{ fourth });
+    // device1, device2, device1 — consecutive device1 transfers share one
+    expect(that % 3 == bus.m_configure_count);
+  };
+
+  "spi_device transaction holds chip select test"_test = []() {
+    // Setup
+    counting_spi bus;
+    spi_device_manager manager(bus);
+    recording_output_pin chip_select;
+    spi_device device(manager, chip_select, { .clock_rate = 1.0_MHz });
+
+    // Exercise
+    {
+      auto scope = device.begin_transaction();
+      expect(bool{ scope });
+      auto first = device.transfer({}, {}, byte{ 0xFF });
+      auto second = device.transfer({}, {}, byte{ 0xFF });
+      expect(bool{ first });
+      expect(bool{ second });
+      // Chip select still asserted between transfers
+      expect(that % false == chip_select.m_state);
+      expect(that % 1 == chip_select.m_toggle_count);
+    }
+
+    // Verify
+    expect(that % 2 == bus.m_transfer_count);
+    expect(that % true == chip_select.m_state);
+    expect(that % 2 == chip_select.m_toggle_count);
+  };
+
+  "spi_device busy during another transaction test"_test = []() {
+    // Setup
+    counting_spi bus;
+    spi_device_manager manager(bus);
+    recording_output_pin chip_select1;
+    recording_output_pin chip_select2;
+    spi_device device1(manager, chip_select1, { .clock_rate = 1.0_MHz });
+    spi_device device2(manager, chip_select2, { .clock_rate = 8.0_MHz });
+
+    // Exercise
+    {
+      auto scope = device1.begin_transaction();
+      auto blocked_transfer = device2.transfer({}, {}, byte{ 0xFF });
+      auto blocked_scope = device2.begin_transaction();
+      expect(bool{ scope });
+      expect(!bool{ blocked_transfer });
+      expect(!bool{ blocked_scope });
+    }
+    auto released_transfer = device2.transfer({}, {}, byte{ 0xFF });
+
+    // Verify
+    expect(bool{ released_transfer });
+    expect(that % true == chip_select1.m_state);
+  };
+};
+}  // namespace hal
@@ -0,0 +1,105 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/cached_sensor.hpp>
+
+#include <libhal/temperature_sensor.hpp>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+class fake_steady_clock : public hal::steady_clock
+{
+public:
+  std::uint64_t m_ticks{ 0 };
+
+private:
+  frequency_t driver_frequency() override
+  {
+    return frequency_t{ .operating_frequency = 1'000'000.0f };
+  };
+  uptime_t driver_uptime() override
+  {
+    return uptime_t{ .ticks = m_ticks };
+  };
+};
+
+class counting_temperature_sensor : public hal::temperature_sensor
+{
+public:
+  int m_read_count{ 0 };
+  celsius m_temperature{ 20.0f };
+  bool m_return_error_status{ false };
+
+  ~counting_temperature_sensor() override = default;
+
+private:
+  result<read_t> driver_read() override
+  {
+    m_read_count++;
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    return read_t{ .temperature = m_temperature };
+  };
+};
+}  // namespace
+
+void cached_sensor_test()
+{
+  using namespace boost::ut;
+  "cached_sensor serves fresh sample test"_test = []() {
+    // Setup
+    fake_steady_clock clock;
+    counting_temperature_sensor sensor;
+    // 1ms max age at 1MHz is 1000 ticks
+    cached_sensor cache(sensor, clock, std::chrono::milliseconds(1));
+
+    // Exercise
+    auto result1 = cache.read();
+    clock.m_ticks = 500;
+    auto result2 = cache.read();
+    clock.m_ticks = 1'001;
+    sensor.m_temperature = 25.0f;
+    auto result3 = cache.read();
+
+    // Verify
+    expect(bool{ result1 });
+    expect(bool{ result2 });
+    expect(bool{ result3 });
+    expect(that % 2 == sensor.m_read_count);
+    expect(that % 20.0f == result2.value().temperature);
+    expect(that % 25.0f == result3.value().temperature);
+  };
+
+  "cached_sensor does not cache errors test"_test = []() {
+    // Setup
+    fake_steady_clock clock;
+    counting_temperature_sensor sensor;
+    cached_sensor cache(sensor, clock, std::chrono::milliseconds(1));
+    sensor.m_return_error_status = true;
+
+    // Exercise
+    auto result1 = cache.read();
+    sensor.m_return_error_status = false;
+    auto result2 = cache.read();
+
+    // Verify
+    expect(!bool{ result1 });
+    expect(bool{ result2 });
+    expect(that % 2 == sensor.m_read_count);
+  };
+};
+}  // namespace hal
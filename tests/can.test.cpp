@@ -71,6 +71,38 @@ private:
     m_handler = p_handler;
   };
 };
+
+class test_queued_can : public test_can
+{
+public:
+  std::span<message_t> m_queue{};
+  std::span<const filter_t> m_filters{};
+
+  ~test_queued_can() override = default;
+
+private:
+  status driver_filter(std::span<const filter_t> p_filters) override
+  {
+    m_filters = p_filters;
+    return success();
+  };
+
+  status driver_attach_receive_queue(std::span<message_t> p_buffer) override
+  {
+    m_queue = p_buffer;
+    return success();
+  };
+
+  result<receive_t> driver_receive(std::span<message_t> p_messages) override
+  {
+    p_messages[0] = m_queue[0];
+    return receive_t{
+      .data = p_messages.first(1),
+      .remaining = 0,
+      .dropped = 0,
+    };
+  };
+};
 }  // namespace
 
 void can_test()
@@ -95,6 +127,215 @@ void can_test()
     expect(that % 1 == counter);
   };
 
+  "can receive queue test"_test = []() {
+    // Setup
+    test_queued_can test;
+    std::array<hal::can::message_t, 4> queue_storage{};
+    std::array<hal::can::message_t, 2> drain_buffer{};
+    queue_storage[0] = expected_message;
+
+    // Exercise
+    auto result1 = test.attach_receive_queue(queue_storage);
+    auto result2 = test.receive(drain_buffer);
+
+    // Verify
+    expect(bool{ result1 });
+    expect(bool{ result2 });
+    expect(that % queue_storage.data() == test.m_queue.data());
+    expect(that % size_t{ 1 } == result2.value().data.size());
+    expect(that % expected_message.id == result2.value().data[0].id);
+  };
+
+  "can acceptance filter test"_test = []() {
+    // Setup
+    test_queued_can test;
+    constexpr std::array<hal::can::filter_t, 2> filters{
+      hal::can::filter_t{ .id = 0x140, .mask = 0x7F0 },
+      hal::can::filter_t{ .id = 0x1800'0000, .mask = 0x1FFF'0000,
+                          .is_extended = true },
+    };
+
+    // Exercise
+    auto result = test.filter(filters);
+
+    // Verify
+    expect(bool{ result });
+    expect(that % filters.data() == test.m_filters.data());
+    expect(that % filters.size() == test.m_filters.size());
+  };
+
+  "can acceptance filter default unsupported test"_test = []() {
+    // Setup
+    test_can test;
+
+    // Exercise
+    auto result = test.filter(std::span<const hal::can::filter_t>{});
+
+    // Verify
+    expect(!bool{ result });
+  };
+
+  "can receive queue default unsupported test"_test = []() {
+    // Setup
+    test_can test;
+    std::array<hal::can::message_t, 4> queue_storage{};
+
+    // Exercise
+    auto result1 = test.attach_receive_queue(queue_storage);
+    auto result2 = test.receive(queue_storage);
+
+    // Verify
+    expect(!bool{ result1 });
+    expect(!bool{ result2 });
+  };
+
+  "can batch send test"_test = []() {
+    // Setup
+    test_can test;
+    std::array<hal::can::message_t, 3> burst{
+      hal::can::message_t{ .id = 0x100 },
+      hal::can::message_t{ .id = 0x200 },
+      hal::can::message_t{ .id = 0x300 },
+    };
+
+    // Exercise: the default implementation sends each frame in order
+    auto result = test.send(std::span<const can::message_t>(burst));
+
+    // Verify: the last frame through the driver is the last of the batch
+    expect(bool{ result });
+    expect(that % hal::can::id_t{ 0x300 } == test.m_message.id);
+  };
+
+  "can transmit queue default unsupported test"_test = []() {
+    // Setup
+    test_can test;
+    std::array<hal::can::message_t, 4> queue_storage{};
+
+    // Exercise
+    auto result = test.attach_transmit_queue(queue_storage);
+
+    // Verify
+    expect(!bool{ result });
+  };
+
+  "can transmit queue priority ordering test"_test = []() {
+    // Setup
+    std::array<hal::can::message_t, 4> storage{};
+    can_transmit_queue queue(storage);
+
+    // Exercise: push out of priority order
+    expect(queue.push({ .id = 0x300 }));
+    expect(queue.push({ .id = 0x100 }));
+    expect(queue.push({ .id = 0x700 }));
+    expect(queue.push({ .id = 0x200 }));
+    // A full queue rejects further messages
+    expect(!queue.push({ .id = 0x050 }));
+
+    // Verify: messages pop lowest ID first, matching bus arbitration
+    expect(that % size_t{ 4 } == queue.size());
+    expect(that % hal::can::id_t{ 0x100 } == queue.pop().value().id);
+    expect(that % hal::can::id_t{ 0x200 } == queue.pop().value().id);
+    expect(that % hal::can::id_t{ 0x300 } == queue.pop().value().id);
+    expect(that % hal::can::id_t{ 0x700 } == queue.pop().value().id);
+    expect(queue.empty());
+    expect(!queue.pop().has_value());
+  };
+
+  "can transmit queue equal id fifo test"_test = []() {
+    // Setup
+    std::array<hal::can::message_t, 6> storage{};
+    can_transmit_queue queue(storage);
+
+    // Exercise: interleave four frames on one ID with other traffic
+    expect(queue.push({ .id = 0x200, .payload = { 1 }, .length = 1 }));
+    expect(queue.push({ .id = 0x100 }));
+    expect(queue.push({ .id = 0x200, .payload = { 2 }, .length = 1 }));
+    expect(queue.push({ .id = 0x200, .payload = { 3 }, .length = 1 }));
+    expect(queue.push({ .id = 0x700 }));
+    expect(queue.push({ .id = 0x200, .payload = { 4 }, .length = 1 }));
+
+    // Verify: equal-ID frames pop in push order with reserved bytes zeroed
+    expect(that % hal::can::id_t{ 0x100 } == queue.pop().value().id);
+    for (hal::byte expected_payload = 1; expected_payload <= 4;
+         expected_payload++) {
+      auto message = queue.pop().value();
+      expect(that % hal::can::id_t{ 0x200 } == message.id);
+      expect(that % expected_payload == message.payload[0]);
+      expect(that % 0 == message.reserved[0]);
+      expect(that % 0 == message.reserved[1]);
+    }
+    expect(that % hal::can::id_t{ 0x700 } == queue.pop().value().id);
+    expect(queue.empty());
+  };
+
+  "can message layout and bulk copy test"_test = []() {
+    // Setup
+    static_assert(sizeof(hal::can::message_t) == 16);
+    std::array<hal::can::message_t, 2> source{
+      hal::can::message_t{ .id = 0x111,
+                           .payload = { 0xAA, 0xBB },
+                           .length = 2 },
+      hal::can::message_t{ .id = 0x222, .is_remote_request = true },
+    };
+    std::array<hal::can::message_t, 2> destination{};
+
+    // Exercise: round-trip the messages through their byte views
+    auto source_bytes = message_bytes(std::span<const can::message_t>(source));
+    auto destination_bytes =
+      message_bytes(std::span<can::message_t>(destination));
+    std::copy(source_bytes.begin(), source_bytes.end(),
+              destination_bytes.begin());
+
+    // Verify
+    expect(that % size_t{ 32 } == source_bytes.size());
+    expect(that % source[0].id == destination[0].id);
+    expect(that % source[0].payload[1] == destination[0].payload[1]);
+    expect(that % source[0].length == destination[0].length);
+    expect(that % source[1].id == destination[1].id);
+    expect(destination[1].is_remote_request);
+  };
+
+  "can bit timing solver test"_test = []() {
+    // Setup: a classic 8 MHz CAN clock targeting 500 kbit/s
+    constexpr auto timing = calculate_can_bit_timing(8.0_MHz, 500.0_kHz);
+    static_assert(timing.has_value());
+    constexpr auto value = timing.value();
+    constexpr std::uint32_t quanta = can::settings::sync_segment +
+                                     value.propagation_delay +
+                                     value.phase_segment1 +
+                                     value.phase_segment2;
+
+    // Verify: the prescaler and quanta reproduce the baud rate exactly
+    static_assert(static_cast<float>(value.prescaler * quanta) * 500'000.0f ==
+                  8'000'000.0f);
+    static_assert(1 <= value.propagation_delay &&
+                  value.propagation_delay <= 8);
+    static_assert(2 <= value.phase_segment1 && value.phase_segment1 <= 8);
+    static_assert(2 <= value.phase_segment2 && value.phase_segment2 <= 8);
+    static_assert(1 <= value.synchronization_jump_width &&
+                  value.synchronization_jump_width <= 4);
+    static_assert(value.synchronization_jump_width < value.phase_segment1);
+    static_assert(value.synchronization_jump_width < value.phase_segment2);
+    // Verify: the sample point lands near the 87.5% default
+    constexpr float sample_point =
+      static_cast<float>(quanta - value.phase_segment2) /
+      static_cast<float>(quanta);
+    static_assert(0.8f < sample_point && sample_point < 0.95f);
+    // Verify: settings conversion carries the solved segments
+    constexpr auto settings = value.to_settings(500.0_kHz);
+    static_assert(settings.phase_segment1 == value.phase_segment1);
+    static_assert(settings.phase_segment2 == value.phase_segment2);
+
+    // Verify: an unreachable baud rate reports no solution
+    constexpr auto impossible = calculate_can_bit_timing(1.0_MHz, 3.0_MHz);
+    static_assert(!impossible.has_value());
+    // Verify: an exact division that only fits in fewer than 6 quanta is
+    // rejected, since its jump width could not stay below the phase
+    // segments
+    constexpr auto too_few_quanta = calculate_can_bit_timing(8.0_MHz, 2.0_MHz);
+    static_assert(!too_few_quanta.has_value());
+  };
+
   "can errors test"_test = []() {
     // Setup
     test_can test;
@@ -14,6 +14,8 @@
 
 #include <libhal/current_sensor.hpp>
 
+#include <array>
+
 #include <boost/ut.hpp>
 
 namespace hal {
@@ -33,6 +35,21 @@ private:
     return read_t{};
   }
 };
+
+class ripple_current_sensor : public hal::current_sensor
+{
+public:
+  ~ripple_current_sensor() override = default;
+
+private:
+  result<read_t> driver_read() override
+  {
+    constexpr std::array<hal::ampere, 4> samples{ 1.0f, 3.0f, 1.0f, 3.0f };
+    return read_t{ .current = samples[m_index++ % samples.size()] };
+  }
+
+  size_t m_index{ 0 };
+};
 }  // namespace
 
 void current_sensor_test()
@@ -45,6 +62,25 @@ void current_sensor_test()
 
     expect(bool{ result });
   };
+  "current sensor statistics test"_test = []() {
+    ripple_current_sensor test;
+
+    auto result = test.statistics(4);
+
+    expect(bool{ result });
+    expect(that % 1.0f == result.value().min);
+    expect(that % 3.0f == result.value().max);
+    expect(that % 2.0f == result.value().mean);
+    // RMS of {1, 3, 1, 3} is sqrt(5)
+    expect(std::abs(result.value().rms - std::sqrt(5.0f)) < 0.0001f);
+  };
+  "current sensor statistics invalid window test"_test = []() {
+    test_current_sensor test;
+
+    auto result = test.statistics(0);
+
+    expect(!bool{ result });
+  };
   "current sensor errors test"_test = []() {
     test_current_sensor test;
     test.m_return_error_status = true;
@@ -37,6 +37,36 @@ private:
     return write_t{};
   }
 };
+
+class test_playback_dac : public test_dac
+{
+public:
+  std::span<const float> m_samples{};
+  hertz m_sample_rate{};
+  playback_mode m_mode{};
+  bool m_stopped{ false };
+
+  ~test_playback_dac() override = default;
+
+private:
+  result<playback_t> driver_play(
+    std::span<const float> p_samples,
+    hertz p_sample_rate,
+    playback_mode p_mode,
+    hal::callback<playback_handler> p_handler) override
+  {
+    m_samples = p_samples;
+    m_sample_rate = p_sample_rate;
+    m_mode = p_mode;
+    p_handler();
+    return playback_t{ .sample_rate = p_sample_rate };
+  }
+  status driver_stop() override
+  {
+    m_stopped = true;
+    return success();
+  }
+};
 }  // namespace
 
 void dac_test()
@@ -56,6 +86,60 @@ void dac_test()
     expect(that % expected_value == test.m_passed_value);
   };
 
+  "dac fixed point write test"_test = []() {
+    // Setup
+    test_dac test;
+
+    // Exercise
+    // The default fixed point virtual converts to float
+    auto result = test.write(0.25_q31);
+
+    // Verify
+    expect(bool{ result });
+    expect(that % 0.0001f > std::abs(test.m_passed_value - 0.25f));
+  };
+
+  "dac playback test"_test = []() {
+    // Setup
+    test_playback_dac test;
+    constexpr std::array<float, 4> waveform{ 0.0f, 0.5f, 1.0f, 0.5f };
+    int playback_complete_count = 0;
+
+    // Exercise
+    auto result1 = test.play(waveform,
+                             10.0_kHz,
+                             dac::playback_mode::circular,
+                             [&playback_complete_count]() {
+                               playback_complete_count++;
+                             });
+    auto result2 = test.stop();
+
+    // Verify
+    expect(bool{ result1 });
+    expect(bool{ result2 });
+    expect(that % waveform.data() == test.m_samples.data());
+    expect(that % waveform.size() == test.m_samples.size());
+    expect(dac::playback_mode::circular == test.m_mode);
+    expect(that % 1 == playback_complete_count);
+    expect(that % 10'000.0f == result1.value().sample_rate);
+    expect(test.m_stopped);
+  };
+
+  "dac playback default unsupported test"_test = []() {
+    // Setup
+    test_dac test;
+    constexpr std::array<float, 2> waveform{ 0.0f, 1.0f };
+
+    // Exercise
+    auto result1 = test.play(
+      waveform, 10.0_kHz, dac::playback_mode::one_shot, []() {});
+    auto result2 = test.stop();
+
+    // Verify
+    expect(!bool{ result1 });
+    expect(!bool{ result2 });
+  };
+
   "dac errors test"_test = []() {
     // Setup
     test_dac test;
@@ -41,6 +41,9 @@ void error_test()
     expect(that % current_call_count < callback_call_count);
   };
 
+#if !defined(LIBHAL_LIGHTWEIGHT_ERROR)
+  // The lightweight policy only records std::errc, so a handler taking an
+  // int payload never matches under it
   "[success] hal::attempt calls handler"_test = []() {
     // Setup
     static const int expected = 123456789;
@@ -58,6 +61,7 @@ void error_test()
     expect(that % value_to_be_change == expected);
     expect(that % true == bool{ result });
   };
+#endif  // LIBHAL_LIGHTWEIGHT_ERROR
 
   "[success] hal::attempt calls handler"_test = []() {
     // Setup
@@ -0,0 +1,115 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/error_trace.hpp>
+
+#include <libhal/error.hpp>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+std::uint64_t fake_tick_count = 0;
+std::uint64_t fake_tick_source()
+{
+  return fake_tick_count;
+}
+}  // namespace
+
+void error_trace_test()
+{
+  using namespace boost::ut;
+
+  "error trace records timestamped sites"_test = []() {
+    // Setup
+    trace::reset();
+    trace::attach_tick_source(&fake_tick_source);
+    std::array<trace::entry_t, LIBHAL_ERROR_TRACE_SIZE> buffer{};
+
+    // Exercise
+    fake_tick_count = 10;
+    trace::record(0x1201);
+    fake_tick_count = 25;
+    trace::record(0x1202);
+    auto entries = trace::dump(buffer);
+
+    // Verify: entries come back oldest first with their tick counts
+    expect(that % size_t{ 2 } == entries.size());
+    expect(that % std::uint32_t{ 0x1201 } == entries[0].site);
+    expect(that % std::uint64_t{ 10 } == entries[0].ticks);
+    expect(that % std::uint32_t{ 0x1202 } == entries[1].site);
+    expect(that % std::uint64_t{ 25 } == entries[1].ticks);
+
+    // Teardown
+    trace::attach_tick_source(nullptr);
+    trace::reset();
+  };
+
+  "error trace overwrites oldest entries when full"_test = []() {
+    // Setup
+    trace::reset();
+    std::array<trace::entry_t, LIBHAL_ERROR_TRACE_SIZE> buffer{};
+
+    // Exercise: overfill the ring by four entries
+    constexpr std::uint32_t total = LIBHAL_ERROR_TRACE_SIZE + 4;
+    for (std::uint32_t site = 0; site < total; site++) {
+      trace::record(site);
+    }
+    auto entries = trace::dump(buffer);
+
+    // Verify: the ring holds the most recent entries, oldest first
+    expect(that % size_t{ LIBHAL_ERROR_TRACE_SIZE } == entries.size());
+    expect(that % std::uint32_t{ 4 } == entries[0].site);
+    expect(that % (total - 1) == entries.back().site);
+
+    // Teardown
+    trace::reset();
+  };
+
+  "error trace site derivation test"_test = []() {
+    // Verify: explicit site tags win over errc, errc over nothing
+    constexpr auto tagged = detail::error_site_of(
+      std::errc::io_error, trace::error_site{ 0x1201 });
+    constexpr auto from_errc = detail::error_site_of(std::errc::io_error);
+    constexpr auto untagged = detail::error_site_of(5);
+    static_assert(tagged == 0x1201);
+    static_assert(from_errc == static_cast<std::uint32_t>(std::errc::io_error));
+    static_assert(untagged == 0);
+  };
+
+#if defined(LIBHAL_ENABLE_ERROR_TRACE)
+  "error trace captures new_error automatically"_test = []() {
+    // Setup
+    trace::reset();
+    std::array<trace::entry_t, LIBHAL_ERROR_TRACE_SIZE> buffer{};
+
+    // Exercise
+    auto make_error = []() -> status {
+      return hal::new_error(std::errc::io_error);
+    };
+    auto result = make_error();
+
+    // Verify
+    auto entries = trace::dump(buffer);
+    expect(!bool{ result });
+    expect(that % size_t{ 1 } == entries.size());
+    expect(that % static_cast<std::uint32_t>(std::errc::io_error) ==
+           entries[0].site);
+
+    // Teardown
+    trace::reset();
+  };
+#endif  // LIBHAL_ENABLE_ERROR_TRACE
+}
+}  // namespace hal
@@ -4,7 +4,7 @@
 // you may not use this file except in compliance with the License.
 // You may obtain a copy of the License at
 //
-//      http://www.apache.org/licenses/LICENSE-2.0
+// http://www.apache.org/licenses/LICENSE-2.0
 //
 // Unless required by applicable law or agreed to in writing, software
 // distributed under the License is distributed on an "AS IS" BASIS,
@@ -14,7 +14,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include <libhal/i2c.hpp>
+#include <libhal/serial.hpp>
+#include <libhal/spi.hpp>
+#include <libhal/steady_clock.hpp>
 
 /**
  * @brief Compares two single floating point values, with in a given error
@@ -27,4 +36,300 @@
  */
 bool compare_floats(float p_first,
                     float p_second,
-                    float p_error_margin = 0.0001f);
\ No newline at end of file
+                    float p_error_margin = 0.0001f);
+
+namespace hal::mock {
+/**
+ * @brief Steady clock mock with manually advanceable deterministic time
+ *
+ * Time only moves when a test advances it, so timeout paths, the timer
+ * wheel and retry schedules can be exercised at exact simulated tick
+ * resolution without real hardware or wall-clock sleeps. The bus mocks
+ * below accept one of these and advance it per transferred byte, modeling
+ * bus time deterministically.
+ */
+class steady_clock : public hal::steady_clock
+{
+public:
+  explicit steady_clock(hertz p_frequency = 1'000'000.0f)
+    : m_frequency(p_frequency)
+  {
+  }
+
+  /// Move simulated time forward
+  void advance(std::uint64_t p_ticks)
+  {
+    m_ticks += p_ticks;
+  }
+
+  /// Current simulated time in ticks
+  [[nodiscard]] std::uint64_t ticks() const
+  {
+    return m_ticks;
+  }
+
+  /// Number of uptime() calls observed
+  std::uint32_t m_uptime_calls{ 0 };
+
+  ~steady_clock() override = default;
+
+private:
+  frequency_t driver_frequency() override
+  {
+    return frequency_t{ .operating_frequency = m_frequency };
+  };
+
+  uptime_t driver_uptime() override
+  {
+    m_uptime_calls++;
+    return uptime_t{ .ticks = m_ticks };
+  };
+
+  hertz m_frequency;
+  std::uint64_t m_ticks{ 0 };
+};
+
+/**
+ * @brief Serial mock with scripted reads, per-byte latency and call counts
+ *
+ * Each entry of m_read_responses services one read() call. When a clock is
+ * attached, every byte moved by read() or write() advances it by
+ * m_ticks_per_byte, so drivers under test observe bus time passing. The
+ * call counters let tests assert performance contracts such as "this
+ * driver issues at most N writes per operation".
+ */
+class serial : public hal::serial
+{
+public:
+  serial() = default;
+
+  serial(steady_clock& p_clock, std::uint64_t p_ticks_per_byte)
+    : m_clock(&p_clock)
+    , m_ticks_per_byte(p_ticks_per_byte)
+  {
+  }
+
+  /// Chunks handed out by successive read() calls
+  std::deque<std::vector<hal::byte>> m_read_responses{};
+  /// Every byte passed to write(), in order
+  std::vector<hal::byte> m_written{};
+  settings m_settings{};
+  bool m_return_error_status{ false };
+  std::uint32_t m_configure_calls{ 0 };
+  std::uint32_t m_write_calls{ 0 };
+  std::uint32_t m_read_calls{ 0 };
+  std::uint32_t m_flush_calls{ 0 };
+
+  ~serial() override = default;
+
+private:
+  void spend_bus_time(size_t p_bytes)
+  {
+    if (m_clock != nullptr) {
+      m_clock->advance(p_bytes * m_ticks_per_byte);
+    }
+  }
+
+  status driver_configure(const settings& p_settings) override
+  {
+    m_configure_calls++;
+    m_settings = p_settings;
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    return success();
+  };
+
+  result<write_t> driver_write(std::span<const hal::byte> p_data) override
+  {
+    m_write_calls++;
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    m_written.insert(m_written.end(), p_data.begin(), p_data.end());
+    spend_bus_time(p_data.size());
+    return write_t{ .data = p_data };
+  };
+
+  result<read_t> driver_read(std::span<hal::byte> p_data) override
+  {
+    m_read_calls++;
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    read_t response{ .data = p_data.first(0),
+                     .available = m_read_responses.size(),
+                     .capacity = 1024 };
+    if (!m_read_responses.empty()) {
+      const auto& chunk = m_read_responses.front();
+      auto length = std::min(chunk.size(), p_data.size());
+      std::copy_n(chunk.begin(), length, p_data.begin());
+      response.data = p_data.first(length);
+      m_read_responses.pop_front();
+      spend_bus_time(length);
+    }
+    return response;
+  };
+
+  result<flush_t> driver_flush() override
+  {
+    m_flush_calls++;
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    return flush_t{};
+  };
+
+  steady_clock* m_clock{ nullptr };
+  std::uint64_t m_ticks_per_byte{ 0 };
+};
+
+/**
+ * @brief I2c mock with scripted responses, per-byte latency and call counts
+ *
+ * Each entry of m_read_responses fills the data_in span of one
+ * transaction. Every transaction records its address and written bytes
+ * into m_transactions for later assertion, and when a clock is attached
+ * the mock advances it by m_ticks_per_byte for every byte moved in either
+ * direction.
+ */
+class i2c : public hal::i2c
+{
+public:
+  /// Record of one observed transaction
+  struct transaction_log
+  {
+    hal::byte address;
+    std::vector<hal::byte> written;
+    size_t read_size;
+  };
+
+  i2c() = default;
+
+  i2c(steady_clock& p_clock, std::uint64_t p_ticks_per_byte)
+    : m_clock(&p_clock)
+    , m_ticks_per_byte(p_ticks_per_byte)
+  {
+  }
+
+  /// Payloads filled into data_in by successive transactions
+  std::deque<std::vector<hal::byte>> m_read_responses{};
+  /// Every transaction observed, in order
+  std::vector<transaction_log> m_transactions{};
+  settings m_settings{};
+  bool m_return_error_status{ false };
+  std::uint32_t m_configure_calls{ 0 };
+  std::uint32_t m_transaction_calls{ 0 };
+
+  ~i2c() override = default;
+
+private:
+  status driver_configure(const settings& p_settings) override
+  {
+    m_configure_calls++;
+    m_settings = p_settings;
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    return success();
+  };
+
+  result<transaction_t> driver_transaction(
+    hal::byte p_address,
+    std::span<const hal::byte> p_data_out,
+    std::span<hal::byte> p_data_in,
+    hal::function_ref<hal::timeout_function> p_timeout) override
+  {
+    m_transaction_calls++;
+    HAL_CHECK(p_timeout());
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    m_transactions.push_back(transaction_log{
+      .address = p_address,
+      .written = { p_data_out.begin(), p_data_out.end() },
+      .read_size = p_data_in.size(),
+    });
+    if (!p_data_in.empty() && !m_read_responses.empty()) {
+      const auto& response = m_read_responses.front();
+      auto length = std::min(response.size(), p_data_in.size());
+      std::copy_n(response.begin(), length, p_data_in.begin());
+      m_read_responses.pop_front();
+    }
+    if (m_clock != nullptr) {
+      m_clock->advance((p_data_out.size() + p_data_in.size()) *
+                       m_ticks_per_byte);
+    }
+    return transaction_t{};
+  };
+
+  steady_clock* m_clock{ nullptr };
+  std::uint64_t m_ticks_per_byte{ 0 };
+};
+
+/**
+ * @brief Spi mock with scripted responses, per-byte latency and call counts
+ *
+ * Follows the same conventions as the i2c mock: scripted data_in fills,
+ * a log of written bytes per transfer, and simulated bus time per byte.
+ */
+class spi : public hal::spi
+{
+public:
+  spi() = default;
+
+  spi(steady_clock& p_clock, std::uint64_t p_ticks_per_byte)
+    : m_clock(&p_clock)
+    , m_ticks_per_byte(p_ticks_per_byte)
+  {
+  }
+
+  /// Payloads filled into data_in by successive transfers
+  std::deque<std::vector<hal::byte>> m_read_responses{};
+  /// Bytes written by each transfer, in order
+  std::vector<std::vector<hal::byte>> m_transfers{};
+  settings m_settings{};
+  bool m_return_error_status{ false };
+  std::uint32_t m_configure_calls{ 0 };
+  std::uint32_t m_transfer_calls{ 0 };
+
+  ~spi() override = default;
+
+private:
+  status driver_configure(const settings& p_settings) override
+  {
+    m_configure_calls++;
+    m_settings = p_settings;
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    return success();
+  };
+
+  result<transfer_t> driver_transfer(std::span<const hal::byte> p_data_out,
+                                     std::span<hal::byte> p_data_in,
+                                     hal::byte p_filler) override
+  {
+    (void)p_filler;
+    m_transfer_calls++;
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    m_transfers.emplace_back(p_data_out.begin(), p_data_out.end());
+    if (!p_data_in.empty() && !m_read_responses.empty()) {
+      const auto& response = m_read_responses.front();
+      auto length = std::min(response.size(), p_data_in.size());
+      std::copy_n(response.begin(), length, p_data_in.begin());
+      m_read_responses.pop_front();
+    }
+    if (m_clock != nullptr) {
+      m_clock->advance(std::max(p_data_out.size(), p_data_in.size()) *
+                       m_ticks_per_byte);
+    }
+    return transfer_t{};
+  };
+
+  steady_clock* m_clock{ nullptr };
+  std::uint64_t m_ticks_per_byte{ 0 };
+};
+}  // namespace hal::mock
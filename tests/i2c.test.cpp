@@ -91,6 +91,166 @@ void i2c_test()
     expect(that % expected_data_in.data() == test.m_data_in.data());
   };
 
+  "i2c async transaction test"_test = []() {
+    // Setup
+    test_i2c test;
+
+    // Exercise
+    auto worker_result = test.transaction_async(
+      expected_address, expected_data_out, expected_data_in);
+    expect(bool{ worker_result });
+    auto state = worker_result.value()();
+
+    // Verify
+    expect(bool{ state });
+    expect(work_state::finished == state.value());
+    expect(that % expected_address == test.m_address);
+    expect(that % expected_data_out.data() == test.m_data_out.data());
+    expect(that % expected_data_in.data() == test.m_data_in.data());
+  };
+
+  "i2c async transaction errors test"_test = []() {
+    // Setup
+    test_i2c test;
+    test.m_return_error_status = true;
+
+    // Exercise
+    auto worker_result = test.transaction_async(
+      expected_address, expected_data_out, expected_data_in);
+    expect(bool{ worker_result });
+    auto state = worker_result.value()();
+
+    // Verify
+    expect(!bool{ state });
+  };
+
+  "i2c batch transaction test"_test = []() {
+    // Setup
+    test_i2c test;
+    constexpr hal::byte second_address{ 101 };
+    const std::array<hal::i2c::transaction_record, 2> batch{
+      hal::i2c::transaction_record{
+        .address = expected_address,
+        .data_out = expected_data_out,
+        .data_in = std::span<hal::byte>{},
+      },
+      hal::i2c::transaction_record{
+        .address = second_address,
+        .data_out = std::span<const hal::byte>{},
+        .data_in = expected_data_in,
+      },
+    };
+
+    // Exercise
+    auto result = test.transaction(batch, expected_timeout);
+
+    // Verify
+    expect(bool{ result });
+    expect(that % second_address == test.m_address);
+    expect(that % expected_data_in.data() == test.m_data_in.data());
+  };
+
+  "i2c batch transaction errors test"_test = []() {
+    // Setup
+    test_i2c test;
+    test.m_return_error_status = true;
+    const std::array<hal::i2c::transaction_record, 1> batch{
+      hal::i2c::transaction_record{
+        .address = expected_address,
+        .data_out = expected_data_out,
+        .data_in = expected_data_in,
+      },
+    };
+
+    // Exercise
+    auto result = test.transaction(batch, expected_timeout);
+
+    // Verify
+    expect(!bool{ result });
+  };
+
+  "i2c poll test"_test = []() {
+    // Setup
+    class status_i2c : public test_i2c
+    {
+    public:
+      int m_transactions{ 0 };
+
+    private:
+      result<transaction_t> driver_transaction(
+        hal::byte p_address,
+        std::span<const hal::byte> p_data_out,
+        std::span<hal::byte> p_data_in,
+        hal::function_ref<hal::timeout_function> p_timeout) override
+      {
+        HAL_CHECK(p_timeout());
+        m_transactions++;
+        // Report busy for the first two reads, then data-ready with extra
+        // unrelated bits set
+        p_data_in[0] = m_transactions < 3 ? 0x00 : 0x8F;
+        m_address = p_address;
+        m_data_out = p_data_out;
+        m_data_in = p_data_in;
+        return transaction_t{};
+      };
+    };
+    status_i2c test;
+    std::array<hal::byte, 1> data_in{};
+
+    // Exercise
+    auto result = test.poll(expected_address,
+                            expected_data_out,
+                            data_in,
+                            { .mask = 0x80, .value = 0x80 },
+                            expected_timeout);
+
+    // Verify
+    expect(bool{ result });
+    expect(that % hal::byte{ 0x8F } == result.value().value);
+    expect(that % size_t{ 3 } == result.value().transaction_count);
+    expect(that % 3 == test.m_transactions);
+  };
+
+  "i2c poll invalid predicate index test"_test = []() {
+    // Setup
+    test_i2c test;
+    std::array<hal::byte, 1> data_in{};
+
+    // Exercise
+    auto result = test.poll(expected_address,
+                            expected_data_out,
+                            data_in,
+                            { .mask = 0x80, .value = 0x80, .index = 1 },
+                            expected_timeout);
+
+    // Verify
+    expect(!bool{ result });
+  };
+
+  "i2c poll timeout test"_test = []() {
+    // Setup
+    test_i2c test;
+    std::array<hal::byte, 1> data_in{};
+    int polls_remaining = 2;
+    auto timeout = [&polls_remaining]() -> hal::status {
+      if (polls_remaining-- == 0) {
+        return hal::new_error(std::errc::timed_out);
+      }
+      return hal::success();
+    };
+
+    // Exercise
+    // The mock never sets the polled bit, so the timeout must end polling
+    auto result = test.poll(expected_address,
+                            expected_data_out,
+                            data_in,
+                            { .mask = 0x80, .value = 0x80 },
+                            timeout);
+
+    // Verify
+    expect(!bool{ result });
+  };
+
   "i2c errors test"_test = []() {
     // Setup
     test_i2c test;
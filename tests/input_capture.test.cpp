@@ -0,0 +1,124 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/input_capture.hpp>
+
+#include <algorithm>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+constexpr hal::input_capture::settings expected_settings{
+  .trigger = hal::input_capture::trigger_edge::both,
+};
+constexpr std::array<std::uint64_t, 3> expected_timestamps{ 100, 250, 400 };
+
+class test_input_capture : public hal::input_capture
+{
+public:
+  settings m_settings{};
+  bool m_return_error_status{ false };
+
+  ~test_input_capture() override = default;
+
+private:
+  status driver_configure(const settings& p_settings) override
+  {
+    m_settings = p_settings;
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    return success();
+  };
+
+  result<frequency_t> driver_frequency() override
+  {
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    return frequency_t{ .frequency = 1'000'000.0f };
+  };
+
+  result<capture_t> driver_capture(
+    std::span<std::uint64_t> p_timestamps) override
+  {
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    auto count = std::min(expected_timestamps.size(), p_timestamps.size());
+    std::copy_n(expected_timestamps.begin(), count, p_timestamps.begin());
+    return capture_t{ .timestamps = p_timestamps.first(count), .lost = 1 };
+  };
+
+  result<period_t> driver_period() override
+  {
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    return period_t{ .ticks = expected_timestamps[1] -
+                              expected_timestamps[0] };
+  };
+};
+}  // namespace
+
+void input_capture_test()
+{
+  using namespace boost::ut;
+  "input_capture interface test"_test = []() {
+    // Setup
+    test_input_capture test;
+    std::array<std::uint64_t, 8> buffer{};
+
+    // Exercise
+    auto result1 = test.configure(expected_settings);
+    auto result2 = test.frequency();
+    auto result3 = test.capture(buffer);
+    auto result4 = test.period();
+
+    // Verify
+    expect(bool{ result1 });
+    expect(bool{ result2 });
+    expect(bool{ result3 });
+    expect(bool{ result4 });
+    expect(expected_settings.trigger == test.m_settings.trigger);
+    expect(that % 1'000'000.0f == result2.value().frequency);
+    expect(that % buffer.data() == result3.value().timestamps.data());
+    expect(that % expected_timestamps.size() ==
+           result3.value().timestamps.size());
+    expect(that % expected_timestamps[2] == result3.value().timestamps[2]);
+    expect(that % size_t{ 1 } == result3.value().lost);
+    expect(that % std::uint64_t{ 150 } == result4.value().ticks);
+  };
+
+  "input_capture errors test"_test = []() {
+    // Setup
+    test_input_capture test;
+    std::array<std::uint64_t, 8> buffer{};
+    test.m_return_error_status = true;
+
+    // Exercise
+    auto result1 = test.configure(expected_settings);
+    auto result2 = test.frequency();
+    auto result3 = test.capture(buffer);
+    auto result4 = test.period();
+
+    // Verify
+    expect(!bool{ result1 });
+    expect(!bool{ result2 });
+    expect(!bool{ result3 });
+    expect(!bool{ result4 });
+  };
+};
+}  // namespace hal
@@ -20,6 +20,7 @@ namespace hal {
 namespace {
 constexpr hal::input_pin::settings expected_settings{
   .resistor = pin_resistor::pull_down,
+  .minimum_stable_duration = std::chrono::milliseconds(5),
 };
 class test_input_pin : public hal::input_pin
 {
@@ -63,6 +64,8 @@ void input_pin_test()
     expect(bool{ result1 });
     expect(bool{ result2 });
     expect(expected_settings.resistor == test.m_settings.resistor);
+    expect(expected_settings.minimum_stable_duration ==
+           test.m_settings.minimum_stable_duration);
     expect(that % true == result2.value().state);
   };
 
@@ -0,0 +1,156 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/input_port.hpp>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+constexpr hal::input_port::settings expected_settings{
+  .resistor = pin_resistor::pull_down,
+};
+
+class test_input_port : public hal::input_port
+{
+public:
+  settings m_settings{};
+  bool m_return_error_status{ false };
+
+  ~test_input_port() override = default;
+
+private:
+  status driver_configure(const settings& p_settings) override
+  {
+    m_settings = p_settings;
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    return success();
+  };
+
+  result<value_t> driver_read() override
+  {
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    return value_t{ .state = 0b1010'0101 };
+  };
+};
+
+class test_streaming_input_port : public test_input_port
+{
+public:
+  std::span<snapshot_t> m_buffer{};
+  hertz m_sample_rate{ 0.0f };
+  bool m_stopped{ false };
+
+  ~test_streaming_input_port() override = default;
+
+private:
+  result<stream_t> driver_stream(
+    std::span<snapshot_t> p_buffer,
+    hertz p_sample_rate,
+    hal::callback<stream_handler> p_handler) override
+  {
+    m_buffer = p_buffer;
+    m_sample_rate = p_sample_rate;
+    // Simulate the first half of the ring buffer filling
+    m_buffer[0] = snapshot_t{ .timestamp = 10, .state = 0b1 };
+    p_handler(m_buffer.first(m_buffer.size() / 2));
+    return stream_t{ .sample_rate = p_sample_rate,
+                     .timestamp_frequency = 1'000'000.0f };
+  };
+
+  status driver_stop() override
+  {
+    m_stopped = true;
+    return success();
+  };
+};
+}  // namespace
+
+void input_port_test()
+{
+  using namespace boost::ut;
+  "input_port interface test"_test = []() {
+    // Setup
+    test_input_port test;
+
+    // Exercise
+    auto result1 = test.configure(expected_settings);
+    auto result2 = test.read();
+
+    // Verify
+    expect(bool{ result1 });
+    expect(bool{ result2 });
+    expect(expected_settings.resistor == test.m_settings.resistor);
+    expect(that % uint32_t{ 0b1010'0101 } == result2.value().state);
+  };
+
+  "input_port stream test"_test = []() {
+    // Setup
+    test_streaming_input_port test;
+    std::array<input_port::snapshot_t, 4> buffer{};
+    size_t delivered = 0;
+    std::uint64_t first_timestamp = 0;
+
+    // Exercise
+    auto result1 = test.stream(
+      buffer, 100'000.0f, [&delivered, &first_timestamp](auto p_snapshots) {
+        delivered = p_snapshots.size();
+        first_timestamp = p_snapshots[0].timestamp;
+      });
+    auto result2 = test.stop();
+
+    // Verify
+    expect(bool{ result1 });
+    expect(bool{ result2 });
+    expect(that % 100'000.0f == result1.value().sample_rate);
+    expect(that % 1'000'000.0f == result1.value().timestamp_frequency);
+    expect(that % buffer.data() == test.m_buffer.data());
+    expect(that % size_t{ 2 } == delivered);
+    expect(that % std::uint64_t{ 10 } == first_timestamp);
+    expect(true == test.m_stopped);
+  };
+
+  "input_port stream default unsupported test"_test = []() {
+    // Setup
+    test_input_port test;
+    std::array<input_port::snapshot_t, 4> buffer{};
+
+    // Exercise
+    auto result1 = test.stream(buffer, 100'000.0f, [](auto) {});
+    auto result2 = test.stop();
+
+    // Verify
+    expect(!bool{ result1 });
+    expect(!bool{ result2 });
+  };
+
+  "input_port errors test"_test = []() {
+    // Setup
+    test_input_port test;
+    test.m_return_error_status = true;
+
+    // Exercise
+    auto result1 = test.configure(expected_settings);
+    auto result2 = test.read();
+
+    // Verify
+    expect(!bool{ result1 });
+    expect(!bool{ result2 });
+  };
+};
+}  // namespace hal
@@ -0,0 +1,101 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/instrumentation.hpp>
+
+#include <libhal/serial.hpp>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+class test_serial : public hal::serial
+{
+public:
+  bool m_return_error_status = false;
+  ~test_serial() override = default;
+
+private:
+  status driver_configure(const settings&) override
+  {
+    return success();
+  }
+  result<write_t> driver_write(std::span<const hal::byte> p_data) override
+  {
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    return write_t{ .data = p_data };
+  }
+  result<read_t> driver_read(std::span<hal::byte> p_data) override
+  {
+    return read_t{
+      .data = p_data.first(0),
+      .available = 0,
+      .capacity = 1,
+    };
+  }
+  result<flush_t> driver_flush() override
+  {
+    return flush_t{};
+  }
+};
+}  // namespace
+
+void instrumentation_test()
+{
+  using namespace boost::ut;
+
+#if defined(LIBHAL_ENABLE_INSTRUMENTATION)
+  "instrumentation counts calls, bytes and errors"_test = []() {
+    // Setup
+    instrument::reset();
+    test_serial test;
+    std::array<hal::byte, 4> payload{};
+
+    // Exercise
+    auto result1 = test.write(payload);
+    test.m_return_error_status = true;
+    auto result2 = test.write(payload);
+
+    // Verify
+    auto counters = instrument::read(instrument::tag::serial_write);
+    expect(bool{ result1 });
+    expect(!bool{ result2 });
+    expect(that % std::uint32_t{ 2 } == counters.calls);
+    expect(that % std::uint32_t{ 1 } == counters.errors);
+    expect(that % std::uint64_t{ 4 } == counters.bytes);
+
+    // Teardown: do not leak counts into other tests
+    instrument::reset();
+  };
+#else
+  "instrumentation disabled reads zeroed counters"_test = []() {
+    // Setup
+    test_serial test;
+    std::array<hal::byte, 4> payload{};
+
+    // Exercise: the registry API stays callable but records nothing
+    instrument::reset();
+    auto result1 = test.write(payload);
+
+    // Verify
+    auto counters = instrument::read(instrument::tag::serial_write);
+    expect(bool{ result1 });
+    expect(that % std::uint32_t{ 0 } == counters.calls);
+    expect(that % std::uint64_t{ 0 } == counters.bytes);
+  };
+#endif  // LIBHAL_ENABLE_INSTRUMENTATION
+}
+}  // namespace hal
@@ -23,6 +23,7 @@ namespace {
 constexpr hal::interrupt_pin::settings expected_settings{
   .resistor = pin_resistor::pull_down,
   .trigger = interrupt_pin::trigger_edge::rising,
+  .minimum_stable_duration = std::chrono::milliseconds(5),
 };
 
 class test_interrupt_pin : public hal::interrupt_pin
@@ -46,6 +47,21 @@ private:
     m_callback = p_callback;
   };
 };
+
+class test_capture_interrupt_pin : public test_interrupt_pin
+{
+public:
+  std::function<timestamped_handler> m_timestamped_callback =
+    [](bool, std::uint64_t) {};
+
+private:
+  result<capture_t> driver_on_trigger(
+    hal::callback<timestamped_handler> p_callback) override
+  {
+    m_timestamped_callback = p_callback;
+    return capture_t{ .frequency = 1.0_MHz };
+  };
+};
 }  // namespace
 
 void interrupt_pin_test()
@@ -66,9 +82,40 @@ void interrupt_pin_test()
     expect(bool{ result });
     expect(expected_settings.resistor == test.m_settings.resistor);
     expect(expected_settings.trigger == test.m_settings.trigger);
+    expect(expected_settings.minimum_stable_duration ==
+           test.m_settings.minimum_stable_duration);
     expect(that % 1 == counter);
   };
 
+  "interrupt_pin timestamped trigger test"_test = []() {
+    // Setup
+    test_capture_interrupt_pin test;
+    std::uint64_t timestamp = 0;
+    auto expected_callback = [&timestamp](bool, std::uint64_t p_timestamp) {
+      timestamp = p_timestamp;
+    };
+
+    // Exercise
+    auto result = test.on_trigger(expected_callback);
+    test.m_timestamped_callback(true, 1234);
+
+    // Verify
+    expect(bool{ result });
+    expect(that % 1'000'000.0f == result.value().frequency);
+    expect(that % std::uint64_t{ 1234 } == timestamp);
+  };
+
+  "interrupt_pin timestamped trigger default unsupported test"_test = []() {
+    // Setup
+    test_interrupt_pin test;
+
+    // Exercise
+    auto result = test.on_trigger([](bool, std::uint64_t) {});
+
+    // Verify
+    expect(!bool{ result });
+  };
+
   "interrupt_pin errors test"_test = []() {
     // Setup
     test_interrupt_pin test;
@@ -0,0 +1,109 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/latency.hpp>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+class manual_clock : public hal::steady_clock
+{
+public:
+  std::uint64_t m_ticks{ 0 };
+
+  ~manual_clock() override = default;
+
+private:
+  frequency_t driver_frequency() override
+  {
+    return frequency_t{ .operating_frequency = 1'000'000.0f };
+  };
+
+  uptime_t driver_uptime() override
+  {
+    return uptime_t{ .ticks = m_ticks };
+  };
+};
+}  // namespace
+
+void latency_test()
+{
+  using namespace boost::ut;
+  "latency_histogram test"_test = []() {
+    // Setup
+    latency_histogram<8> histogram;
+
+    // Exercise
+    histogram.record(1);    // bucket 1: [1, 2)
+    histogram.record(5);    // bucket 3: [4, 8)
+    histogram.record(6);    // bucket 3: [4, 8)
+    histogram.record(1000); // beyond 2^7, saturates into bucket 7
+    auto summary = histogram.summary();
+
+    // Verify
+    expect(that % std::uint32_t{ 4 } == summary.count);
+    expect(that % std::uint64_t{ 1 } == summary.min);
+    expect(that % std::uint64_t{ 1000 } == summary.max);
+    expect(that % std::uint64_t{ 1012 } == summary.total);
+    expect(that % std::uint32_t{ 1 } == histogram.buckets()[1]);
+    expect(that % std::uint32_t{ 2 } == histogram.buckets()[3]);
+    expect(that % std::uint32_t{ 1 } == histogram.buckets()[7]);
+  };
+
+  "latency_histogram empty and reset test"_test = []() {
+    // Setup
+    latency_histogram<8> histogram;
+
+    // Exercise
+    auto empty_summary = histogram.summary();
+    histogram.record(42);
+    histogram.reset();
+    auto reset_summary = histogram.summary();
+
+    // Verify
+    expect(that % std::uint32_t{ 0 } == empty_summary.count);
+    expect(that % std::uint64_t{ 0 } == empty_summary.min);
+    expect(that % std::uint64_t{ 0 } == empty_summary.max);
+    expect(that % std::uint32_t{ 0 } == reset_summary.count);
+    expect(that % std::uint64_t{ 0 } == reset_summary.total);
+  };
+
+  "latency_recorder test"_test = []() {
+    // Setup
+    manual_clock clock;
+    latency_recorder<8> recorder(clock);
+
+    // Exercise
+    clock.m_ticks = 100;
+    recorder.event();
+    clock.m_ticks = 112;
+    recorder.callback();
+    // Second event supersedes the first before its callback runs
+    recorder.event(200);
+    recorder.event(220);
+    clock.m_ticks = 250;
+    recorder.callback();
+    // A callback with no pending event records nothing
+    recorder.callback();
+    auto summary = recorder.histogram().summary();
+
+    // Verify
+    expect(that % std::uint32_t{ 2 } == summary.count);
+    expect(that % std::uint64_t{ 12 } == summary.min);
+    expect(that % std::uint64_t{ 30 } == summary.max);
+    expect(that % std::uint64_t{ 42 } == summary.total);
+  };
+};
+}  // namespace hal
@@ -0,0 +1,92 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/lockfree.hpp>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+struct sample
+{
+  std::uint32_t id;
+  float value;
+};
+}  // namespace
+
+void lockfree_test()
+{
+  using namespace boost::ut;
+  "latest_value test"_test = []() {
+    // Setup
+    latest_value<sample> cell;
+
+    // Exercise
+    auto empty = cell.read();
+    cell.write(sample{ .id = 1, .value = 1.5f });
+    cell.write(sample{ .id = 2, .value = 2.5f });
+    auto latest = cell.read();
+    auto again = cell.read();
+
+    // Verify
+    expect(!empty.has_value());
+    expect(latest.has_value());
+    expect(that % std::uint32_t{ 2 } == latest.value().id);
+    expect(that % 2.5f == latest.value().value);
+    // Reads do not consume the value
+    expect(again.has_value());
+    expect(that % std::uint32_t{ 2 } == again.value().id);
+  };
+
+  "spsc_ring push pop test"_test = []() {
+    // Setup
+    spsc_ring<std::uint32_t, 4> ring;
+
+    // Exercise
+    auto empty_pop = ring.pop();
+    expect(ring.push(10));
+    expect(ring.push(20));
+    expect(ring.push(30));
+    auto first = ring.pop();
+    auto second = ring.pop();
+
+    // Verify
+    expect(!empty_pop.has_value());
+    expect(that % std::uint32_t{ 10 } == first.value());
+    expect(that % std::uint32_t{ 20 } == second.value());
+    expect(that % size_t{ 1 } == ring.size());
+    expect(!ring.empty());
+  };
+
+  "spsc_ring full and wraparound test"_test = []() {
+    // Setup
+    spsc_ring<std::uint32_t, 4> ring;
+
+    // Exercise & Verify
+    for (std::uint32_t index = 0; index < 4; index++) {
+      expect(ring.push(index));
+    }
+    expect(!ring.push(99));
+    expect(that % size_t{ 4 } == ring.size());
+    // Drain and refill several times to exercise index wraparound
+    for (std::uint32_t round = 0; round < 8; round++) {
+      auto popped = ring.pop();
+      expect(popped.has_value());
+      expect(that % std::uint32_t{ round } == popped.value());
+      expect(ring.push(round + 4));
+    }
+    expect(that % size_t{ 4 } == ring.size());
+  };
+};
+}  // namespace hal
@@ -14,21 +14,50 @@
 
 namespace hal {
 extern void adc_test();
+extern void async_test();
+extern void bit_test();
+extern void buffered_serial_test();
+extern void bus_manager_test();
+extern void cached_sensor_test();
 extern void can_test();
 extern void dac_test();
 extern void error_test();
+extern void error_trace_test();
 extern void i2c_test();
+extern void input_capture_test();
 extern void input_pin_test();
+extern void input_port_test();
+extern void instrumentation_test();
 extern void interrupt_pin_test();
+extern void latency_test();
+extern void lockfree_test();
+extern void mock_test();
 extern void motor_test();
+extern void motor_group_test();
 extern void output_pin_test();
+extern void pool_test();
+extern void output_port_test();
 extern void pwm_test();
+extern void quadrature_counter_test();
+extern void register_cache_test();
+extern void retry_test();
+extern void sample_block_test();
+extern void scheduler_test();
 extern void serial_test();
 extern void spi_test();
+extern void static_callback_test();
+extern void stream_test();
+extern void static_dispatch_test();
 extern void steady_clock_test();
+extern void task_test();
+extern void telemetry_test();
 extern void timeout_test();
 extern void timer_test();
+extern void timer_wheel_test();
+extern void units_test();
+extern void vec3_test();
 extern void servo_test();
+extern void servo_group_test();
 extern void g_force_test();
 extern void lengths_test();
 extern void angular_velocity_sensor_test();
@@ -38,21 +67,50 @@ extern void current_sensor_test();
 int main()
 {
   hal::adc_test();
+  hal::async_test();
+  hal::bit_test();
+  hal::buffered_serial_test();
+  hal::bus_manager_test();
+  hal::cached_sensor_test();
   hal::can_test();
   hal::dac_test();
   hal::error_test();
+  hal::error_trace_test();
   hal::i2c_test();
+  hal::input_capture_test();
   hal::input_pin_test();
+  hal::input_port_test();
+  hal::instrumentation_test();
   hal::interrupt_pin_test();
+  hal::latency_test();
+  hal::lockfree_test();
+  hal::mock_test();
   hal::motor_test();
+  hal::motor_group_test();
   hal::output_pin_test();
+  hal::pool_test();
+  hal::output_port_test();
   hal::pwm_test();
+  hal::quadrature_counter_test();
+  hal::register_cache_test();
+  hal::retry_test();
+  hal::sample_block_test();
+  hal::scheduler_test();
   hal::serial_test();
   hal::spi_test();
+  hal::static_callback_test();
+  hal::stream_test();
+  hal::static_dispatch_test();
   hal::steady_clock_test();
+  hal::task_test();
+  hal::telemetry_test();
   hal::servo_test();
+  hal::servo_group_test();
   hal::timeout_test();
   hal::timer_test();
+  hal::timer_wheel_test();
+  hal::units_test();
+  hal::vec3_test();
   hal::g_force_test();
   hal::lengths_test();
   hal::angular_velocity_sensor_test();
@@ -0,0 +1,129 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "helpers.hpp"
+
+#include <boost/ut.hpp>
+
+namespace hal {
+void mock_test()
+{
+  using namespace boost::ut;
+  "mock steady_clock test"_test = []() {
+    // Setup
+    mock::steady_clock clock(1'000'000.0f);
+
+    // Exercise
+    auto start = clock.uptime().ticks;
+    clock.advance(250);
+    auto end = clock.uptime().ticks;
+
+    // Verify
+    expect(that % std::uint64_t{ 0 } == start);
+    expect(that % std::uint64_t{ 250 } == end);
+    expect(that % 1'000'000.0f == clock.frequency().operating_frequency);
+    expect(that % std::uint32_t{ 2 } == clock.m_uptime_calls);
+  };
+
+  "mock serial per-byte latency test"_test = []() {
+    // Setup
+    mock::steady_clock clock;
+    // 87 ticks per byte, roughly one 8N1 frame at 115200 baud and 1 MHz
+    mock::serial port(clock, 87);
+    port.m_read_responses = { { 'o', 'k' } };
+    const std::array<hal::byte, 4> payload{ 'a', 'b', 'c', 'd' };
+    std::array<hal::byte, 8> buffer{};
+
+    // Exercise
+    auto write_result = port.write(payload);
+    auto read_result = port.read(buffer);
+
+    // Verify
+    expect(bool{ write_result });
+    expect(bool{ read_result });
+    expect(that % size_t{ 2 } == read_result.value().data.size());
+    expect(that % std::uint64_t{ 6 * 87 } == clock.ticks());
+    expect(that % std::uint32_t{ 1 } == port.m_write_calls);
+    expect(that % std::uint32_t{ 1 } == port.m_read_calls);
+    expect(that % size_t{ 4 } == port.m_written.size());
+  };
+
+  "mock i2c transaction budget test"_test = []() {
+    // Setup
+    mock::steady_clock clock;
+    mock::i2c bus(clock, 25);
+    bus.m_read_responses = { { 0x12, 0x34 } };
+    const std::array<hal::byte, 1> register_index{ 0x0F };
+    std::array<hal::byte, 2> data_in{};
+
+    // Exercise
+    auto result = bus.transaction(
+      0x68, register_index, data_in, hal::never_timeout());
+
+    // Verify
+    expect(bool{ result });
+    expect(that % hal::byte{ 0x12 } == data_in[0]);
+    expect(that % hal::byte{ 0x34 } == data_in[1]);
+    // Performance contract: one register read costs exactly one transaction
+    expect(that % std::uint32_t{ 1 } == bus.m_transaction_calls);
+    expect(that % size_t{ 1 } == bus.m_transactions.size());
+    expect(that % hal::byte{ 0x68 } == bus.m_transactions[0].address);
+    expect(that % std::uint64_t{ 3 * 25 } == clock.ticks());
+  };
+
+  "mock i2c simulated timeout test"_test = []() {
+    // Setup
+    mock::steady_clock clock;
+    mock::i2c bus(clock, 100);
+    std::array<hal::byte, 2> data_in{};
+    constexpr std::uint64_t deadline = 450;
+    auto timeout = [&clock]() -> hal::status {
+      if (clock.ticks() >= deadline) {
+        return hal::new_error(std::errc::timed_out);
+      }
+      return hal::success();
+    };
+
+    // Exercise
+    // Each poll costs 2 bytes of simulated bus time; the predicate never
+    // matches, so the deadline must end the poll after the third transaction
+    auto result = bus.poll(
+      0x68, std::span<const hal::byte>{}, data_in,
+      { .mask = 0x01, .value = 0x01 }, timeout);
+
+    // Verify
+    expect(!bool{ result });
+    expect(that % std::uint32_t{ 3 } == bus.m_transaction_calls);
+  };
+
+  "mock spi scripted transfer test"_test = []() {
+    // Setup
+    mock::steady_clock clock;
+    mock::spi bus(clock, 10);
+    bus.m_read_responses = { { 0xDE, 0xAD } };
+    const std::array<hal::byte, 2> command{ 0x9F, 0x00 };
+    std::array<hal::byte, 2> data_in{};
+
+    // Exercise
+    auto result = bus.transfer(command, data_in, hal::spi::default_filler);
+
+    // Verify
+    expect(bool{ result });
+    expect(that % hal::byte{ 0xDE } == data_in[0]);
+    expect(that % std::uint32_t{ 1 } == bus.m_transfer_calls);
+    expect(that % size_t{ 2 } == bus.m_transfers[0].size());
+    expect(that % std::uint64_t{ 20 } == clock.ticks());
+  };
+};
+}  // namespace hal
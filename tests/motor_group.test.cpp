@@ -0,0 +1,98 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/motor_group.hpp>
+
+#include <array>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+class test_motor : public hal::motor
+{
+public:
+  float m_power{ 0.0f };
+
+  ~test_motor() override = default;
+
+private:
+  result<power_t> driver_power(float p_power) override
+  {
+    m_power = p_power;
+    return power_t{};
+  };
+};
+}  // namespace
+
+void motor_group_test()
+{
+  using namespace boost::ut;
+  "independent_motor_group update test"_test = []() {
+    // Setup
+    test_motor motor0;
+    test_motor motor1;
+    std::array<motor*, 2> motors{ &motor0, &motor1 };
+    independent_motor_group group(motors);
+    constexpr std::array<motor_group::command, 2> commands{
+      motor_group::command{ .channel = 0, .power = 0.5f },
+      motor_group::command{ .channel = 1, .power = -0.5f },
+    };
+
+    // Exercise
+    auto result = group.update(commands);
+
+    // Verify
+    expect(bool{ result });
+    expect(that % 0.5f == motor0.m_power);
+    expect(that % -0.5f == motor1.m_power);
+  };
+
+  "independent_motor_group invalid channel test"_test = []() {
+    // Setup
+    test_motor motor0;
+    std::array<motor*, 1> motors{ &motor0 };
+    independent_motor_group group(motors);
+    constexpr std::array<motor_group::command, 1> commands{
+      motor_group::command{ .channel = 2, .power = 1.0f },
+    };
+
+    // Exercise
+    auto result = group.update(commands);
+
+    // Verify
+    expect(!bool{ result });
+    expect(that % 0.0f == motor0.m_power);
+  };
+
+  "independent_motor_group valid-then-invalid batch test"_test = []() {
+    // Setup
+    test_motor motor0;
+    std::array<motor*, 1> motors{ &motor0 };
+    independent_motor_group group(motors);
+    constexpr std::array<motor_group::command, 2> commands{
+      motor_group::command{ .channel = 0, .power = 1.0f },
+      motor_group::command{ .channel = 2, .power = -1.0f },
+    };
+
+    // Exercise
+    auto result = group.update(commands);
+
+    // Verify: the valid command ahead of the bad channel must not have
+    // driven its motor
+    expect(!bool{ result });
+    expect(that % 0.0f == motor0.m_power);
+  };
+};
+}  // namespace hal
@@ -0,0 +1,100 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/output_port.hpp>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+constexpr hal::output_port::settings expected_settings{
+  .resistor = pin_resistor::pull_down,
+  .open_drain = true,
+};
+class test_output_port : public hal::output_port
+{
+public:
+  settings m_settings{};
+  uint32_t m_port_value{};
+  bool m_return_error_status{ false };
+
+  ~test_output_port() override = default;
+
+private:
+  status driver_configure(const settings& p_settings) override
+  {
+    m_settings = p_settings;
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    return success();
+  };
+  result<set_value_t> driver_write(uint32_t p_mask, uint32_t p_value) override
+  {
+    m_port_value = (m_port_value & ~p_mask) | (p_value & p_mask);
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    return set_value_t{};
+  };
+  result<value_t> driver_read() override
+  {
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    return value_t{ .state = m_port_value };
+  };
+};
+}  // namespace
+
+void output_port_test()
+{
+  using namespace boost::ut;
+  "output_port interface test"_test = []() {
+    // Setup
+    test_output_port test;
+
+    // Exercise
+    auto result1 = test.configure(expected_settings);
+    auto result2 = test.write(0xFF, 0xA5);
+    auto result3 = test.write(0x0F, 0x03);
+    auto result4 = test.read();
+
+    // Verify
+    expect(bool{ result1 });
+    expect(bool{ result2 });
+    expect(bool{ result3 });
+    expect(bool{ result4 });
+    expect(expected_settings.open_drain == test.m_settings.open_drain);
+    expect(expected_settings.resistor == test.m_settings.resistor);
+    expect(that % uint32_t{ 0xA3 } == result4.value().state);
+  };
+
+  "output_port errors test"_test = []() {
+    // Setup
+    test_output_port test;
+    test.m_return_error_status = true;
+
+    // Exercise
+    auto result1 = test.configure(expected_settings);
+    auto result2 = test.write(0xFF, 0xA5);
+    auto result3 = test.read();
+
+    // Verify
+    expect(!bool{ result1 });
+    expect(!bool{ result2 });
+    expect(!bool{ result3 });
+  };
+};
+}  // namespace hal
@@ -0,0 +1,109 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/pool.hpp>
+
+#include <optional>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+size_t fill_buffer(std::span<hal::byte> p_buffer)
+{
+  for (auto& value : p_buffer) {
+    value = 0xAA;
+  }
+  return p_buffer.size();
+}
+}  // namespace
+
+void pool_test()
+{
+  using namespace boost::ut;
+
+  "block pool acquire and release test"_test = []() {
+    // Setup
+    block_pool<32, 4> pool;
+
+    // Exercise
+    auto buffer1 = pool.acquire();
+    auto buffer2 = pool.acquire();
+
+    // Verify
+    expect(bool{ buffer1 });
+    expect(bool{ buffer2 });
+    expect(that % size_t{ 32 } == buffer1.value().size());
+    expect(that % size_t{ 2 } == pool.available());
+    expect(buffer1.value().data().data() != buffer2.value().data().data());
+    // Verify: the handle passes directly to span-based APIs
+    expect(that % size_t{ 32 } == fill_buffer(buffer1.value()));
+  };
+
+  "block pool handles return storage on destruction"_test = []() {
+    // Setup
+    block_pool<16, 2> pool;
+
+    // Exercise
+    {
+      auto buffer1 = pool.acquire();
+      auto buffer2 = pool.acquire();
+      expect(that % size_t{ 0 } == pool.available());
+      // Exercise: a full pool reports not_enough_memory
+      auto buffer3 = pool.acquire();
+      expect(!bool{ buffer3 });
+    }
+
+    // Verify
+    expect(that % size_t{ 2 } == pool.available());
+    expect(bool{ pool.acquire() });
+  };
+
+  "block pool move semantics test"_test = []() {
+    // Setup
+    block_pool<16, 1> pool;
+    std::optional<pool_buffer> holder;
+
+    // Exercise: ownership transfers without releasing the block
+    {
+      auto buffer = pool.acquire();
+      holder = std::move(buffer.value());
+    }
+
+    // Verify
+    expect(that % size_t{ 0 } == pool.available());
+    expect(!holder->empty());
+    holder.reset();
+    expect(that % size_t{ 1 } == pool.available());
+  };
+
+  "interrupt safe block pool test"_test = []() {
+    // Setup
+    block_pool<8, 3, true> pool;
+
+    // Exercise
+    auto buffer1 = pool.acquire();
+    auto buffer2 = pool.acquire();
+    auto buffer3 = pool.acquire();
+    auto buffer4 = pool.acquire();
+
+    // Verify
+    expect(bool{ buffer1 });
+    expect(bool{ buffer2 });
+    expect(bool{ buffer3 });
+    expect(!bool{ buffer4 });
+    expect(that % size_t{ 0 } == pool.available());
+  };
+}
+}  // namespace hal
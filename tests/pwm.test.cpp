@@ -68,6 +68,50 @@ void pwm_test()
     expect(that % expected_duty_cycle == test.m_duty_cycle);
   };
 
+  "pwm fixed point duty cycle test"_test = []() {
+    // Setup
+    test_pwm test;
+    constexpr auto expected_ratio = 0.5_q31;
+
+    // Exercise
+    // The default fixed point virtual converts to float
+    auto result1 = test.duty_cycle(expected_ratio);
+    auto result2 = test.duty_cycle(q31::from_float(-0.5f));
+
+    // Verify
+    expect(bool{ result1 });
+    expect(bool{ result2 });
+    // Negative ratios are clamped to 0%
+    expect(that % 0.0f == test.m_duty_cycle);
+    expect(that % expected_ratio.raw == q31::from_float(0.5f).raw);
+  };
+
+  "pwm combined waveform update test"_test = []() {
+    // Setup
+    test_pwm test;
+
+    // Exercise
+    // The default implementation applies the frequency then the duty cycle
+    auto result = test.waveform(expected_frequency, expected_duty_cycle);
+
+    // Verify
+    expect(bool{ result });
+    expect(that % expected_frequency == test.m_frequency);
+    expect(that % expected_duty_cycle == test.m_duty_cycle);
+    expect(that % std::uint32_t{ 0 } == result.value().period_ticks);
+  };
+
+  "pwm duty ticks default unsupported test"_test = []() {
+    // Setup
+    test_pwm test;
+
+    // Exercise
+    auto result = test.duty_ticks(500);
+
+    // Verify
+    expect(!bool{ result });
+  };
+
   "pwm errors test"_test = []() {
     // Setup
     test_pwm test;
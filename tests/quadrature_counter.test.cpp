@@ -0,0 +1,107 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/quadrature_counter.hpp>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+constexpr hal::quadrature_counter::settings expected_settings{
+  .mode = hal::quadrature_counter::decoding::x2,
+};
+
+class test_quadrature_counter : public hal::quadrature_counter
+{
+public:
+  settings m_settings{};
+  std::int64_t m_count{ -4096 };
+  bool m_reset_called{ false };
+  bool m_return_error_status{ false };
+
+  ~test_quadrature_counter() override = default;
+
+private:
+  status driver_configure(const settings& p_settings) override
+  {
+    m_settings = p_settings;
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    return success();
+  };
+
+  result<count_t> driver_read() override
+  {
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    return count_t{ .count = m_count, .counts_per_revolution = 2048 };
+  };
+
+  status driver_reset() override
+  {
+    m_reset_called = true;
+    if (m_return_error_status) {
+      return hal::new_error();
+    }
+    m_count = 0;
+    return success();
+  };
+};
+}  // namespace
+
+void quadrature_counter_test()
+{
+  using namespace boost::ut;
+  "quadrature_counter interface test"_test = []() {
+    // Setup
+    test_quadrature_counter test;
+
+    // Exercise
+    auto result1 = test.configure(expected_settings);
+    auto result2 = test.read();
+    auto result3 = test.reset();
+    auto result4 = test.read();
+
+    // Verify
+    expect(bool{ result1 });
+    expect(bool{ result2 });
+    expect(bool{ result3 });
+    expect(bool{ result4 });
+    expect(expected_settings.mode == test.m_settings.mode);
+    expect(that % std::int64_t{ -4096 } == result2.value().count);
+    expect(that % std::uint32_t{ 2048 } ==
+           result2.value().counts_per_revolution);
+    expect(true == test.m_reset_called);
+    expect(that % std::int64_t{ 0 } == result4.value().count);
+  };
+
+  "quadrature_counter errors test"_test = []() {
+    // Setup
+    test_quadrature_counter test;
+    test.m_return_error_status = true;
+
+    // Exercise
+    auto result1 = test.configure(expected_settings);
+    auto result2 = test.read();
+    auto result3 = test.reset();
+
+    // Verify
+    expect(!bool{ result1 });
+    expect(!bool{ result2 });
+    expect(!bool{ result3 });
+  };
+};
+}  // namespace hal
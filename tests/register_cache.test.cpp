@@ -0,0 +1,151 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/register_cache.hpp>
+
+#include <vector>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+// Simulates a device with an auto-incrementing register pointer
+class test_register_device : public hal::i2c
+{
+public:
+  std::array<hal::byte, 16> m_registers{};
+  int m_transaction_count = 0;
+  std::vector<size_t> m_write_lengths{};
+  ~test_register_device() override = default;
+
+private:
+  status driver_configure(const settings&) override
+  {
+    return success();
+  }
+
+  result<transaction_t> driver_transaction(
+    hal::byte,
+    std::span<const hal::byte> p_data_out,
+    std::span<hal::byte> p_data_in,
+    hal::function_ref<hal::timeout_function>) override
+  {
+    m_transaction_count++;
+    if (!p_data_out.empty()) {
+      auto reg = p_data_out[0];
+      for (size_t index = 1; index < p_data_out.size(); index++) {
+        m_registers.at(reg + index - 1) = p_data_out[index];
+      }
+      if (p_data_out.size() > 1) {
+        m_write_lengths.push_back(p_data_out.size() - 1);
+      }
+      for (size_t index = 0; index < p_data_in.size(); index++) {
+        p_data_in[index] = m_registers.at(reg + index);
+      }
+    }
+    return transaction_t{};
+  }
+};
+}  // namespace
+
+void register_cache_test()
+{
+  using namespace boost::ut;
+
+  "register cache serves clean reads from ram"_test = []() {
+    // Setup
+    test_register_device device;
+    device.m_registers[3] = 0xAB;
+    i2c_register_cache<8> cache(device, 0x20, 0x00);
+
+    // Exercise
+    auto first = cache.read(0x03, hal::never_timeout());
+    auto second = cache.read(0x03, hal::never_timeout());
+
+    // Verify: one bus transaction, the second read came from RAM
+    expect(that % hal::byte{ 0xAB } == first.value());
+    expect(that % hal::byte{ 0xAB } == second.value());
+    expect(that % 1 == device.m_transaction_count);
+  };
+
+  "register cache write-through updates the copy"_test = []() {
+    // Setup
+    test_register_device device;
+    i2c_register_cache<8> cache(device, 0x20, 0x00);
+
+    // Exercise
+    auto write_status = cache.write(0x02, 0x55, hal::never_timeout());
+    auto value = cache.read(0x02, hal::never_timeout());
+
+    // Verify: the device saw the write and the read cost no transaction
+    expect(bool{ write_status });
+    expect(that % hal::byte{ 0x55 } == device.m_registers[2]);
+    expect(that % hal::byte{ 0x55 } == value.value());
+    expect(that % 1 == device.m_transaction_count);
+  };
+
+  "register cache coalesces staged writes into bursts"_test = []() {
+    // Setup
+    test_register_device device;
+    i2c_register_cache<8> cache(device, 0x20, 0x00);
+
+    // Exercise: two consecutive runs separated by a gap
+    expect(bool{ cache.stage(0x01, 0x11) });
+    expect(bool{ cache.stage(0x02, 0x22) });
+    expect(bool{ cache.stage(0x03, 0x33) });
+    expect(bool{ cache.stage(0x06, 0x66) });
+    expect(that % size_t{ 4 } == cache.dirty_count());
+    expect(that % 0 == device.m_transaction_count);
+    auto flush_status = cache.flush(hal::never_timeout());
+
+    // Verify: one three-byte burst and one single-byte write
+    expect(bool{ flush_status });
+    expect(that % 2 == device.m_transaction_count);
+    expect(that % size_t{ 3 } == device.m_write_lengths.at(0));
+    expect(that % size_t{ 1 } == device.m_write_lengths.at(1));
+    expect(that % hal::byte{ 0x22 } == device.m_registers[2]);
+    expect(that % hal::byte{ 0x66 } == device.m_registers[6]);
+    expect(that % size_t{ 0 } == cache.dirty_count());
+  };
+
+  "register cache invalidation forces a device read"_test = []() {
+    // Setup
+    test_register_device device;
+    i2c_register_cache<8> cache(device, 0x20, 0x00);
+    (void)cache.read(0x04, hal::never_timeout());
+
+    // Exercise: the device changes the register behind the cache's back
+    device.m_registers[4] = 0x99;
+    auto stale = cache.read(0x04, hal::never_timeout());
+    expect(bool{ cache.invalidate(0x04) });
+    auto fresh = cache.read(0x04, hal::never_timeout());
+
+    // Verify
+    expect(that % hal::byte{ 0x00 } == stale.value());
+    expect(that % hal::byte{ 0x99 } == fresh.value());
+  };
+
+  "register cache rejects out-of-window registers"_test = []() {
+    // Setup
+    test_register_device device;
+    i2c_register_cache<4> cache(device, 0x20, 0x02);
+
+    // Exercise + Verify
+    expect(!bool{ cache.read(0x01, hal::never_timeout()) });
+    expect(!bool{ cache.read(0x06, hal::never_timeout()) });
+    expect(!bool{ cache.stage(0x08, 0xFF) });
+    expect(bool{ cache.stage(0x05, 0xFF) });
+  };
+}
+}  // namespace hal
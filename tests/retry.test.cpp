@@ -0,0 +1,135 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/retry.hpp>
+
+#include "helpers.hpp"
+
+#include <boost/ut.hpp>
+
+namespace hal {
+void retry_test()
+{
+  using namespace boost::ut;
+  using namespace std::chrono_literals;
+
+  "retrier succeeds after transient failures test"_test = []() {
+    // Setup
+    mock::steady_clock clock;
+    int attempts = 0;
+    retrier engine(clock,
+                   retry_policy{ .attempts = 5 },
+                   [&attempts]() -> hal::status {
+                     attempts++;
+                     if (attempts < 3) {
+                       return hal::new_error(std::errc::io_error);
+                     }
+                     return hal::success();
+                   });
+
+    // Exercise
+    auto result = engine.run();
+
+    // Verify
+    expect(bool{ result });
+    expect(that % 3 == attempts);
+  };
+
+  "retrier exhausts policy test"_test = []() {
+    // Setup
+    mock::steady_clock clock;
+    int attempts = 0;
+    retrier engine(clock,
+                   retry_policy{ .attempts = 3 },
+                   [&attempts]() -> hal::status {
+                     attempts++;
+                     return hal::new_error(std::errc::io_error);
+                   });
+
+    // Exercise
+    auto result = engine.run();
+    // A terminal worker stays terminal
+    auto after = engine();
+
+    // Verify
+    expect(!bool{ result });
+    expect(that % 3 == attempts);
+    expect(bool{ after });
+    expect(work_state::failed == after.value());
+  };
+
+  "retrier exponential backoff test"_test = []() {
+    // Setup
+    mock::steady_clock clock(1'000'000'000.0f);  // 1 tick per nanosecond
+    int attempts = 0;
+    retrier engine(clock,
+                   retry_policy{ .attempts = 4,
+                                 .initial_delay = 100ns,
+                                 .backoff_factor = 2.0f,
+                                 .max_delay = 150ns },
+                   [&attempts]() -> hal::status {
+                     attempts++;
+                     return hal::new_error(std::errc::io_error);
+                   });
+
+    // Exercise & Verify
+    // First attempt runs immediately and fails, scheduling a 100 tick delay
+    auto poll1 = engine();
+    expect(work_state::in_progress == poll1.value());
+    expect(that % 1 == attempts);
+    // Still waiting out the backoff: no attempt happens
+    auto poll2 = engine();
+    expect(that % 1 == attempts);
+    expect(work_state::in_progress == poll2.value());
+    // Second attempt after 100 ticks; next delay caps at 150 not 200
+    clock.advance(100);
+    auto poll3 = engine();
+    expect(that % 2 == attempts);
+    expect(work_state::in_progress == poll3.value());
+    clock.advance(149);
+    auto poll4 = engine();
+    expect(that % 2 == attempts);
+    expect(work_state::in_progress == poll4.value());
+    clock.advance(1);
+    auto poll5 = engine();
+    expect(that % 3 == attempts);
+    expect(work_state::in_progress == poll5.value());
+    // Final attempt exhausts the policy and reports the error
+    clock.advance(150);
+    auto poll6 = engine();
+    expect(!bool{ poll6 });
+    expect(that % 4 == attempts);
+  };
+
+  "retry convenience function test"_test = []() {
+    // Setup
+    mock::steady_clock clock;
+    int attempts = 0;
+
+    // Exercise
+    auto result =
+      retry(clock, retry_policy{ .attempts = 2 }, [&attempts]() -> hal::status {
+        attempts++;
+        if (attempts < 2) {
+          return hal::new_error(std::errc::io_error);
+        }
+        return hal::success();
+      });
+
+    // Verify
+    expect(bool{ result });
+    expect(that % 2 == attempts);
+  };
+};
+}  // namespace hal
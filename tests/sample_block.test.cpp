@@ -0,0 +1,86 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/sample_block.hpp>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+void sample_block_test()
+{
+  using namespace boost::ut;
+  "sample_block append test"_test = []() {
+    // Setup
+    sample_block<4> block;
+
+    // Exercise
+    auto result1 = block.append(100, vec3{ .x = 1.0f, .y = 2.0f, .z = 3.0f });
+    auto result2 = block.append(110, vec3{ .x = 4.0f, .y = 5.0f, .z = 6.0f });
+
+    // Verify
+    expect(result1);
+    expect(result2);
+    expect(that % size_t{ 2 } == block.size());
+    expect(!block.full());
+    expect(that % std::uint64_t{ 100 } == block.ticks()[0]);
+    expect(that % std::uint64_t{ 110 } == block.ticks()[1]);
+    expect(that % 1.0f == block.x()[0]);
+    expect(that % 5.0f == block.y()[1]);
+    expect(that % 6.0f == block.z()[1]);
+    expect(vec3{ .x = 4.0f, .y = 5.0f, .z = 6.0f } == block.sample(1));
+  };
+
+  "sample_block batch append and overflow test"_test = []() {
+    // Setup
+    sample_block<4> block;
+    const std::array<vec3, 3> batch{
+      vec3{ .x = 1.0f, .y = 0.0f, .z = 0.0f },
+      vec3{ .x = 2.0f, .y = 0.0f, .z = 0.0f },
+      vec3{ .x = 3.0f, .y = 0.0f, .z = 0.0f },
+    };
+
+    // Exercise
+    auto appended1 = block.append(1000, 10, batch);
+    // Only one slot remains for the second batch
+    auto appended2 = block.append(2000, 10, batch);
+    auto rejected = block.append(3000, vec3{});
+
+    // Verify
+    expect(that % size_t{ 3 } == appended1);
+    expect(that % size_t{ 1 } == appended2);
+    expect(!rejected);
+    expect(block.full());
+    expect(that % std::uint64_t{ 1020 } == block.ticks()[2]);
+    expect(that % std::uint64_t{ 2000 } == block.ticks()[3]);
+    expect(that % 3.0f == block.x()[2]);
+    expect(that % 1.0f == block.x()[3]);
+  };
+
+  "sample_block serialization and clear test"_test = []() {
+    // Setup
+    sample_block<4> block;
+    expect(block.append(42, vec3{ .x = 7.0f, .y = 8.0f, .z = 9.0f }));
+
+    // Exercise
+    auto bytes = block.as_bytes();
+    block.clear();
+
+    // Verify
+    expect(that % sizeof(block) == bytes.size());
+    expect(that % reinterpret_cast<const hal::byte*>(&block) == bytes.data());
+    expect(that % size_t{ 0 } == block.size());
+    expect(that % size_t{ 0 } == block.ticks().size());
+  };
+};
+}  // namespace hal
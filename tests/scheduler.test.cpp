@@ -0,0 +1,106 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/scheduler.hpp>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+auto make_counting_worker(int& p_polls, int p_polls_to_finish)
+{
+  return [&p_polls, p_polls_to_finish]() -> result<work_state> {
+    p_polls++;
+    if (p_polls >= p_polls_to_finish) {
+      return work_state::finished;
+    }
+    return work_state::in_progress;
+  };
+}
+}  // namespace
+
+void scheduler_test()
+{
+  using namespace boost::ut;
+  "scheduler round-robin test"_test = []() {
+    // Setup
+    scheduler<4> schedule;
+    int short_polls = 0;
+    int long_polls = 0;
+
+    // Exercise
+    auto add1 = schedule.add(make_counting_worker(short_polls, 1));
+    auto add2 = schedule.add(make_counting_worker(long_polls, 3));
+    auto pass1 = schedule.run_once();
+    auto pass2 = schedule.run_once();
+    auto pass3 = schedule.run_once();
+
+    // Verify
+    expect(bool{ add1 });
+    expect(bool{ add2 });
+    expect(work_state::in_progress == pass1.value());
+    expect(work_state::in_progress == pass2.value());
+    expect(work_state::finished == pass3.value());
+    // The short worker is retired after the first pass
+    expect(that % 1 == short_polls);
+    expect(that % 3 == long_polls);
+    expect(that % size_t{ 0 } == schedule.active());
+  };
+
+  "scheduler capacity test"_test = []() {
+    // Setup
+    scheduler<1> schedule;
+    int polls = 0;
+
+    // Exercise
+    auto add1 = schedule.add(make_counting_worker(polls, 2));
+    auto add2 = schedule.add(make_counting_worker(polls, 2));
+    auto pass1 = schedule.run_once();
+    auto pass2 = schedule.run_once();
+    // Retiring the worker frees its slot
+    auto add3 = schedule.add(make_counting_worker(polls, 1));
+
+    // Verify
+    expect(bool{ add1 });
+    expect(!bool{ add2 });
+    expect(work_state::in_progress == pass1.value());
+    expect(work_state::finished == pass2.value());
+    expect(bool{ add3 });
+    expect(that % size_t{ 1 } == schedule.active());
+  };
+
+  "scheduler retires failed worker test"_test = []() {
+    // Setup
+    scheduler<2> schedule;
+    int polls = 0;
+
+    // Exercise
+    auto add1 = schedule.add(
+      []() -> result<work_state> { return hal::new_error(std::errc::io_error); });
+    auto add2 = schedule.add(make_counting_worker(polls, 2));
+    auto pass1 = schedule.run_once();
+    auto pass2 = schedule.run_once();
+    auto pass3 = schedule.run_once();
+
+    // Verify
+    expect(bool{ add1 });
+    expect(bool{ add2 });
+    expect(!bool{ pass1 });
+    // The surviving worker continues on subsequent passes
+    expect(work_state::in_progress == pass2.value());
+    expect(work_state::finished == pass3.value());
+    expect(that % 2 == polls);
+  };
+};
+}  // namespace hal
@@ -14,6 +14,8 @@
 
 #include <libhal/serial.hpp>
 
+#include <vector>
+
 #include <boost/ut.hpp>
 
 namespace hal {
@@ -72,6 +74,68 @@ private:
     return flush_t{};
   };
 };
+
+class test_borrow_serial : public test_serial
+{
+public:
+  std::array<hal::byte, 4> m_working_buffer{ 'w', 'x', 'y', 'z' };
+  size_t m_consumed{ 0 };
+
+  ~test_borrow_serial() override = default;
+
+private:
+  result<borrow_t> driver_borrow() override
+  {
+    return borrow_t{
+      .data = { std::span<const hal::byte>(m_working_buffer).subspan(2),
+                std::span<const hal::byte>(m_working_buffer).first(2) },
+    };
+  };
+
+  status driver_consume(size_t p_count) override
+  {
+    m_consumed += p_count;
+    return success();
+  };
+};
+
+class test_chunked_serial : public test_serial
+{
+public:
+  int m_write_calls{ 0 };
+
+  ~test_chunked_serial() override = default;
+
+private:
+  result<write_t> driver_write(std::span<const hal::byte> p_data) override
+  {
+    m_write_calls++;
+    // Accept at most two bytes per call to exercise multi-poll completion
+    return write_t{ p_data.first(std::min<size_t>(p_data.size(), 2)) };
+  };
+};
+
+class test_gather_serial : public test_serial
+{
+public:
+  std::vector<hal::byte> m_written{};
+  int m_gather_calls{ 0 };
+
+  ~test_gather_serial() override = default;
+
+private:
+  result<write_vector_t> driver_write(
+    std::span<const std::span<const hal::byte>> p_segments) override
+  {
+    m_gather_calls++;
+    size_t transmitted = 0;
+    for (const auto& segment : p_segments) {
+      m_written.insert(m_written.end(), segment.begin(), segment.end());
+      transmitted += segment.size();
+    }
+    return write_vector_t{ .transmitted = transmitted };
+  };
+};
 }  // namespace
 
 void serial_test()
@@ -103,6 +167,129 @@ void serial_test()
     expect(true == test.m_flush_called);
   };
 
+  "serial borrow test"_test = []() {
+    // Setup
+    test_borrow_serial test;
+
+    // Exercise
+    auto result1 = test.borrow();
+    auto result2 = test.consume(2);
+
+    // Verify
+    expect(bool{ result1 });
+    expect(bool{ result2 });
+    expect(that % (test.m_working_buffer.data() + 2) ==
+           result1.value().data[0].data());
+    expect(that % test.m_working_buffer.data() ==
+           result1.value().data[1].data());
+    expect(that % size_t{ 2 } == test.m_consumed);
+  };
+
+  "serial borrow default unsupported test"_test = []() {
+    // Setup
+    test_serial test;
+
+    // Exercise
+    auto result1 = test.borrow();
+    auto result2 = test.consume(1);
+
+    // Verify
+    expect(!bool{ result1 });
+    expect(!bool{ result2 });
+  };
+
+  "serial gather write override test"_test = []() {
+    // Setup
+    test_gather_serial test;
+    const std::array<hal::byte, 2> header{ 'h', 'd' };
+    const std::array<hal::byte, 4> payload{ 'p', 'a', 'y', 'l' };
+    const std::array<hal::byte, 2> crc{ 'c', 'r' };
+    const std::array<std::span<const hal::byte>, 3> segments{ header,
+                                                              payload,
+                                                              crc };
+    const std::vector<hal::byte> expected{ 'h', 'd', 'p', 'a',
+                                           'y', 'l', 'c', 'r' };
+
+    // Exercise
+    auto result = test.write(segments);
+
+    // Verify
+    expect(bool{ result });
+    expect(that % 1 == test.m_gather_calls);
+    expect(that % size_t{ 8 } == result.value().transmitted);
+    expect(expected == test.m_written);
+  };
+
+  "serial gather write default test"_test = []() {
+    // Setup
+    test_chunked_serial test;
+    const std::array<hal::byte, 3> header{ 'h', 'd', 'r' };
+    const std::array<hal::byte, 0> empty{};
+    const std::array<hal::byte, 2> crc{ 'c', 'r' };
+    const std::array<std::span<const hal::byte>, 3> segments{ header,
+                                                              empty,
+                                                              crc };
+
+    // Exercise
+    auto result = test.write(segments);
+
+    // Verify: each segment drains through the single-span path, which
+    // accepts at most two bytes per call
+    expect(bool{ result });
+    expect(that % size_t{ 5 } == result.value().transmitted);
+    expect(that % 3 == test.m_write_calls);
+  };
+
+  "serial gather write error test"_test = []() {
+    // Setup
+    test_serial test;
+    const std::array<hal::byte, 2> header{ 'h', 'd' };
+    const std::array<std::span<const hal::byte>, 1> segments{ header };
+    test.m_return_error_status = true;
+
+    // Exercise
+    auto result = test.write(segments);
+
+    // Verify
+    expect(!bool{ result });
+  };
+
+  "serial write_async test"_test = []() {
+    // Setup
+    test_chunked_serial test;
+    const std::array<hal::byte, 5> expected_payload{ 'a', 'b', 'c', 'd', 'e' };
+
+    // Exercise
+    auto worker = test.write_async(expected_payload).value();
+    auto poll1 = worker();
+    auto poll2 = worker();
+    auto poll3 = worker();
+    auto poll4 = worker();
+
+    // Verify
+    expect(work_state::in_progress == poll1.value());
+    expect(work_state::in_progress == poll2.value());
+    expect(work_state::finished == poll3.value());
+    expect(work_state::finished == poll4.value());
+    expect(that % 3 == test.m_write_calls);
+  };
+
+  "serial write_async error test"_test = []() {
+    // Setup
+    test_serial test;
+    const std::array<hal::byte, 4> expected_payload{ 'a', 'b' };
+    test.m_return_error_status = true;
+
+    // Exercise
+    auto worker = test.write_async(expected_payload).value();
+    auto poll1 = worker();
+    auto poll2 = worker();
+
+    // Verify
+    expect(!bool{ poll1 });
+    expect(work_state::failed == poll2.value());
+  };
+
   "serial errors test"_test = []() {
     // Setup
     test_serial test;
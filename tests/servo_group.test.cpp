@@ -0,0 +1,98 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/servo_group.hpp>
+
+#include <array>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+class test_servo : public hal::servo
+{
+public:
+  hal::degrees m_position = 0.0f;
+
+  ~test_servo() override = default;
+
+private:
+  result<position_t> driver_position(hal::degrees p_position) override
+  {
+    m_position = p_position;
+    return position_t{};
+  };
+};
+}  // namespace
+
+void servo_group_test()
+{
+  using namespace boost::ut;
+  "independent_servo_group update test"_test = []() {
+    // Setup
+    test_servo servo0;
+    test_servo servo1;
+    std::array<servo*, 2> servos{ &servo0, &servo1 };
+    independent_servo_group group(servos);
+    constexpr std::array<servo_group::command, 2> commands{
+      servo_group::command{ .channel = 1, .position = 45.0f },
+      servo_group::command{ .channel = 0, .position = -45.0f },
+    };
+
+    // Exercise
+    auto result = group.update(commands);
+
+    // Verify
+    expect(bool{ result });
+    expect(that % -45.0f == servo0.m_position);
+    expect(that % 45.0f == servo1.m_position);
+  };
+
+  "independent_servo_group invalid channel test"_test = []() {
+    // Setup
+    test_servo servo0;
+    std::array<servo*, 1> servos{ &servo0 };
+    independent_servo_group group(servos);
+    constexpr std::array<servo_group::command, 1> commands{
+      servo_group::command{ .channel = 1, .position = 45.0f },
+    };
+
+    // Exercise
+    auto result = group.update(commands);
+
+    // Verify
+    expect(!bool{ result });
+    expect(that % 0.0f == servo0.m_position);
+  };
+
+  "independent_servo_group valid-then-invalid batch test"_test = []() {
+    // Setup
+    test_servo servo0;
+    std::array<servo*, 1> servos{ &servo0 };
+    independent_servo_group group(servos);
+    constexpr std::array<servo_group::command, 2> commands{
+      servo_group::command{ .channel = 0, .position = 45.0f },
+      servo_group::command{ .channel = 1, .position = -45.0f },
+    };
+
+    // Exercise
+    auto result = group.update(commands);
+
+    // Verify: the valid command ahead of the bad channel must not have moved
+    // its servo
+    expect(!bool{ result });
+    expect(that % 0.0f == servo0.m_position);
+  };
+};
+}  // namespace hal
@@ -80,6 +80,48 @@ void spi_test()
     expect(expected_filler == test.m_filler);
   };
 
+  "spi multi-segment transfer test"_test = []() {
+    // Setup
+    test_spi test;
+    const std::array<hal::byte, 4> expected_header{ 'c', 'm', 'd', '!' };
+    std::array<hal::byte, 4> expected_payload{};
+    const auto expected_filler = ' ';
+    const std::array<hal::spi::transfer_segment, 2> segments{
+      hal::spi::transfer_segment{
+        .data_out = expected_header,
+        .data_in = std::span<hal::byte>{},
+      },
+      hal::spi::transfer_segment{
+        .data_out = std::span<const hal::byte>{},
+        .data_in = expected_payload,
+        .filler = expected_filler,
+      },
+    };
+
+    // Exercise
+    auto result = test.transfer(segments);
+
+    // Verify
+    expect(bool{ result });
+    expect(that % expected_payload.data() == test.m_data_in.data());
+    expect(expected_filler == test.m_filler);
+  };
+
+  "spi multi-segment transfer errors test"_test = []() {
+    // Setup
+    test_spi test;
+    test.m_return_error_status = true;
+    const std::array<hal::spi::transfer_segment, 1> segments{
+      hal::spi::transfer_segment{},
+    };
+
+    // Exercise
+    auto result = test.transfer(segments);
+
+    // Verify
+    expect(!bool{ result });
+  };
+
   "spi errors test"_test = []() {
     // Setup
     test_spi test;
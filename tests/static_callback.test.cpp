@@ -0,0 +1,124 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/functional.hpp>
+
+#include <libhal/interrupt_pin.hpp>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+int free_function_calls = 0;
+void free_function_handler(bool p_state)
+{
+  if (p_state) {
+    free_function_calls++;
+  }
+}
+
+class event_counter
+{
+public:
+  int m_count = 0;
+  void handle(bool p_state)
+  {
+    if (p_state) {
+      m_count++;
+    }
+  }
+  [[nodiscard]] int doubled() const
+  {
+    return m_count * 2;
+  }
+};
+
+class test_interrupt_pin : public hal::interrupt_pin
+{
+public:
+  hal::callback<handler> m_handler = [](bool) {};
+  ~test_interrupt_pin() override = default;
+
+private:
+  status driver_configure(const settings&) override
+  {
+    return success();
+  }
+  void driver_on_trigger(hal::callback<handler> p_handler) override
+  {
+    m_handler = p_handler;
+  }
+};
+}  // namespace
+
+void static_callback_test()
+{
+  using namespace boost::ut;
+
+  "static callback member binding test"_test = []() {
+    // Setup
+    event_counter counter;
+    static_callback<&event_counter::handle> handler(counter);
+
+    // Exercise
+    handler(true);
+    handler(false);
+    handler(true);
+
+    // Verify
+    expect(that % 2 == counter.m_count);
+    // Verify: the binding is a single pointer of state
+    static_assert(sizeof(handler) == sizeof(void*));
+  };
+
+  "static callback const member binding test"_test = []() {
+    // Setup
+    event_counter counter;
+    counter.m_count = 21;
+    static_callback<&event_counter::doubled> reader(counter);
+
+    // Exercise + Verify
+    expect(that % 42 == reader());
+  };
+
+  "static callback free function binding test"_test = []() {
+    // Setup
+    free_function_calls = 0;
+    static_callback<&free_function_handler> handler;
+
+    // Exercise
+    handler(true);
+    interrupt_pin::handler* raw_pointer = handler;
+    raw_pointer(true);
+
+    // Verify: stateless and convertible to a plain function pointer
+    expect(that % 2 == free_function_calls);
+    static_assert(sizeof(handler) == 1);
+  };
+
+  "static callback converts to interface callbacks"_test = []() {
+    // Setup
+    event_counter counter;
+    test_interrupt_pin pin;
+    static_callback<&event_counter::handle> handler(counter);
+
+    // Exercise: install through the normal hal::callback pathway
+    pin.on_trigger(handler);
+    pin.m_handler(true);
+
+    // Verify
+    expect(that % 1 == counter.m_count);
+  };
+}
+}  // namespace hal
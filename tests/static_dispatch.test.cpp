@@ -0,0 +1,93 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/static_dispatch.hpp>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+// A driver with the output_pin API that does not inherit hal::output_pin
+class static_output_pin
+{
+public:
+  output_pin::settings m_settings{};
+  bool m_state{ false };
+
+  status configure(const output_pin::settings& p_settings)
+  {
+    m_settings = p_settings;
+    return success();
+  }
+  result<output_pin::set_level_t> level(bool p_high)
+  {
+    m_state = p_high;
+    return output_pin::set_level_t{};
+  }
+  result<output_pin::level_t> level()
+  {
+    return output_pin::level_t{ .state = m_state };
+  }
+};
+
+class static_adc
+{
+public:
+  result<adc::read_t> read()
+  {
+    return adc::read_t{ .sample = 0.25f };
+  }
+};
+
+static_assert(output_pin_driver<static_output_pin>);
+static_assert(adc_driver<static_adc>);
+static_assert(!output_pin_driver<static_adc>);
+}  // namespace
+
+void static_dispatch_test()
+{
+  using namespace boost::ut;
+
+  "output_pin_adapter test"_test = []() {
+    // Setup
+    static_output_pin driver;
+    output_pin_adapter<static_output_pin> adapter(driver);
+    hal::output_pin& pin = adapter;
+
+    // Exercise
+    auto result1 = pin.level(true);
+    auto result2 = pin.level();
+
+    // Verify
+    expect(bool{ result1 });
+    expect(bool{ result2 });
+    expect(that % true == driver.m_state);
+    expect(that % true == result2.value().state);
+  };
+
+  "adc_adapter test"_test = []() {
+    // Setup
+    static_adc driver;
+    adc_adapter<static_adc> adapter(driver);
+    hal::adc& adc_reference = adapter;
+
+    // Exercise
+    auto result = adc_reference.read();
+
+    // Verify
+    expect(bool{ result });
+    expect(that % 0.25f == result.value().sample);
+  };
+};
+}  // namespace hal
@@ -37,6 +37,19 @@ private:
     return uptime_t{ .ticks = m_uptime };
   };
 };
+
+class test_fast_steady_clock : public test_steady_clock
+{
+public:
+  constexpr static std::uint32_t m_raw_count{ 0xABCD };
+  ~test_fast_steady_clock() override = default;
+
+private:
+  std::uint32_t driver_uptime32() override
+  {
+    return m_raw_count;
+  }
+};
 }  // namespace
 
 void steady_clock_test()
@@ -54,5 +67,43 @@ void steady_clock_test()
     expect(that % test.m_frequency == result1.operating_frequency);
     expect(that % test.m_uptime == result2.ticks);
   };
+
+  "steady_clock uptime32 test"_test = []() {
+    // Setup
+    test_steady_clock truncating;
+    test_fast_steady_clock raw;
+
+    // Exercise + Verify: default shim truncates the 64-bit tick count,
+    // overriding drivers return the raw counter directly
+    expect(that % std::uint32_t{ 100 } == truncating.uptime32());
+    expect(that % test_fast_steady_clock::m_raw_count == raw.uptime32());
+  };
+
+  "overflow counter extension test"_test = []() {
+    // Setup
+    overflow_counter<32> counter;
+
+    // Exercise + Verify: counts pass through until the counter wraps
+    expect(that % std::uint64_t{ 50 } == counter.update(50));
+    expect(that % std::uint64_t{ 0xF000'0000 } == counter.update(0xF000'0000));
+    // Wraparound adds 2^32 to subsequent counts
+    expect(that % (std::uint64_t{ 1 } << 32 | 10) == counter.update(10));
+    expect(that % (std::uint64_t{ 1 } << 32 | 20) == counter.update(20));
+    // Reset discards the accumulated overflows
+    counter.reset();
+    expect(that % std::uint64_t{ 30 } == counter.update(30));
+  };
+
+  "overflow counter narrow counter test"_test = []() {
+    // Setup: a 24-bit SysTick style counter
+    overflow_counter<24> counter;
+
+    // Exercise + Verify
+    expect(that % std::uint64_t{ 0x80'0000 } == counter.update(0x80'0000));
+    expect(that % (std::uint64_t{ 1 } << 24 | 5) == counter.update(5));
+    // Values wider than the counter are masked down
+    expect(that % (std::uint64_t{ 1 } << 24 | 6) ==
+           counter.update(0xFF00'0006 & 0x00FF'FFFF));
+  };
 };
 }  // namespace hal
@@ -0,0 +1,179 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/stream.hpp>
+
+#include <deque>
+#include <vector>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+class scripted_serial : public hal::serial
+{
+public:
+  std::deque<std::vector<hal::byte>> m_chunks{};
+
+  ~scripted_serial() override = default;
+
+private:
+  status driver_configure(const settings&) override
+  {
+    return success();
+  };
+
+  result<write_t> driver_write(std::span<const hal::byte> p_data) override
+  {
+    return write_t{ p_data };
+  };
+
+  result<read_t> driver_read(std::span<hal::byte> p_data) override
+  {
+    read_t response{ .data = p_data.first(0), .available = 0, .capacity = 32 };
+    if (!m_chunks.empty()) {
+      const auto& chunk = m_chunks.front();
+      auto length = std::min(chunk.size(), p_data.size());
+      std::copy_n(chunk.begin(), length, p_data.begin());
+      response.data = p_data.first(length);
+      m_chunks.pop_front();
+    }
+    return response;
+  };
+
+  result<flush_t> driver_flush() override
+  {
+    return flush_t{};
+  };
+};
+}  // namespace
+
+void stream_test()
+{
+  using namespace boost::ut;
+  "stream_framer frame splitting test"_test = []() {
+    // Setup
+    scripted_serial port;
+    std::array<hal::byte, 16> frame_buffer{};
+    stream_framer framer(port, frame_buffer, '\n');
+    // Two frames split across three reads plus an empty frame to skip
+    port.m_chunks = { { 'h', 'i' }, { '\n', '\n', 'y' }, { 'o', '\n' } };
+
+    // Exercise
+    // Spans from read_frame() are invalidated by the next call, so copy each
+    // frame's bytes out before pulling the next one.
+    auto frame1 = framer.read_frame();
+    expect(bool{ frame1 });
+    expect(that % frame_buffer.data() == frame1.value().data());
+    std::vector<hal::byte> copy1(frame1.value().begin(), frame1.value().end());
+    auto frame2 = framer.read_frame();
+    expect(bool{ frame2 });
+    std::vector<hal::byte> copy2(frame2.value().begin(), frame2.value().end());
+    auto frame3 = framer.read_frame();
+
+    // Verify
+    expect(that % size_t{ 2 } == copy1.size());
+    expect(that % 'h' == copy1[0]);
+    expect(that % 'i' == copy1[1]);
+    expect(that % size_t{ 2 } == copy2.size());
+    expect(that % 'y' == copy2[0]);
+    expect(that % 'o' == copy2[1]);
+    expect(bool{ frame3 });
+    expect(that % size_t{ 0 } == frame3.value().size());
+  };
+
+  "stream_framer overflow resynchronization test"_test = []() {
+    // Setup
+    scripted_serial port;
+    std::array<hal::byte, 4> frame_buffer{};
+    stream_framer framer(port, frame_buffer, '\n');
+    // First frame exceeds the 4 byte buffer; framing must resume at 'o', 'k'
+    port.m_chunks = { { '1', '2', '3', '4' },
+                      { '5', '\n' },
+                      { 'o', 'k', '\n' } };
+
+    // Exercise
+    auto result1 = framer.read_frame();
+    auto result2 = framer.read_frame();
+
+    // Verify
+    expect(!bool{ result1 });
+    expect(bool{ result2 });
+    expect(that % size_t{ 2 } == result2.value().size());
+    expect(that % 'o' == result2.value()[0]);
+    expect(that % 'k' == result2.value()[1]);
+  };
+
+  "cobs_decode test"_test = []() {
+    // Setup
+    cobs_decode decoder;
+    // Encoding of { 0x11, 0x22, 0x00, 0x33 }
+    std::array<hal::byte, 5> encoded{ 0x03, 0x11, 0x22, 0x02, 0x33 };
+    std::array<hal::byte, 2> malformed{ 0x05, 0x11 };
+
+    // Exercise
+    auto decoded = decoder(encoded);
+    auto error = decoder(malformed);
+
+    // Verify
+    expect(bool{ decoded });
+    expect(that % size_t{ 4 } == decoded.value().size());
+    expect(that % 0x11 == decoded.value()[0]);
+    expect(that % 0x22 == decoded.value()[1]);
+    expect(that % 0x00 == decoded.value()[2]);
+    expect(that % 0x33 == decoded.value()[3]);
+    expect(that % encoded.data() == decoded.value().data());
+    expect(!bool{ error });
+  };
+
+  "stream_pipeline test"_test = []() {
+    // Setup
+    scripted_serial port;
+    std::array<hal::byte, 16> frame_buffer{};
+    stream_framer framer(port, frame_buffer, 0x00);
+    int frames_checked = 0;
+    auto length_check =
+      [&frames_checked](
+        std::span<hal::byte> p_frame) -> result<std::span<hal::byte>> {
+      frames_checked++;
+      if (p_frame.size() < 2) {
+        return hal::new_error(std::errc::bad_message);
+      }
+      return p_frame;
+    };
+    stream_pipeline pipeline(framer, cobs_decode{}, length_check);
+    // COBS frame decoding to { 0x11, 0x00, 0x22 }, then one decoding to a
+    // single byte which the length check stage must reject
+    port.m_chunks = { { 0x02, 0x11, 0x02, 0x22, 0x00 },
+                      { 0x02, 0x55, 0x00 } };
+
+    // Exercise
+    auto frame1 = pipeline.read_frame();
+    expect(bool{ frame1 });
+    std::vector<hal::byte> copy1(frame1.value().begin(), frame1.value().end());
+    auto frame2 = pipeline.read_frame();
+    auto frame3 = pipeline.read_frame();
+
+    // Verify
+    expect(that % size_t{ 3 } == copy1.size());
+    expect(that % 0x11 == copy1[0]);
+    expect(that % 0x00 == copy1[1]);
+    expect(that % 0x22 == copy1[2]);
+    expect(!bool{ frame2 });
+    expect(bool{ frame3 });
+    expect(that % size_t{ 0 } == frame3.value().size());
+    expect(that % 2 == frames_checked);
+  };
+};
+}  // namespace hal
@@ -0,0 +1,137 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/task.hpp>
+
+#include <array>
+#include <optional>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+task<int> three_step_task()
+{
+  co_await yield;
+  co_await yield;
+  co_return 42;
+}
+
+task<int> failing_task()
+{
+  co_await yield;
+  co_return hal::new_error(std::errc::io_error);
+}
+
+task<int> parent_task()
+{
+  auto child = co_await three_step_task();
+  if (!child) {
+    co_return child.error();
+  }
+  co_await yield;
+  co_return child.value() + 1;
+}
+}  // namespace
+
+void task_test()
+{
+  using namespace boost::ut;
+  "task polls to completion test"_test = []() {
+    // Setup
+    auto work = three_step_task();
+
+    // Exercise
+    auto poll1 = work();
+    auto poll2 = work();
+    auto poll3 = work();
+    auto poll4 = work();
+
+    // Verify
+    expect(work_state::in_progress == poll1.value());
+    expect(work_state::in_progress == poll2.value());
+    expect(work_state::finished == poll3.value());
+    expect(work_state::finished == poll4.value());
+    expect(that % 42 == work.value().value());
+  };
+
+  "task error propagation test"_test = []() {
+    // Setup
+    auto work = failing_task();
+
+    // Exercise
+    auto poll1 = work();
+    auto poll2 = work();
+    auto value = work.value();
+
+    // Verify
+    expect(work_state::in_progress == poll1.value());
+    expect(!bool{ poll2 });
+    expect(!bool{ value });
+  };
+
+  "task value before completion test"_test = []() {
+    // Setup
+    auto work = three_step_task();
+
+    // Exercise
+    auto poll1 = work();
+    auto value = work.value();
+
+    // Verify
+    expect(work_state::in_progress == poll1.value());
+    expect(!bool{ value });
+  };
+
+  "task awaits child task test"_test = []() {
+    // Setup
+    auto work = parent_task();
+
+    // Exercise
+    // Parent runs until awaiting the child, then each poll resumes the
+    // child until it finishes, then the parent's trailing yield.
+    int polls = 0;
+    result<work_state> state = work_state::in_progress;
+    while (state && state.value() == work_state::in_progress && polls < 10) {
+      state = work();
+      polls++;
+    }
+
+    // Verify
+    expect(work_state::finished == state.value());
+    expect(that % 4 == polls);
+    expect(that % 43 == work.value().value());
+  };
+
+  "task frame pool exhaustion test"_test = []() {
+    // Setup
+    std::array<std::optional<task<int>>, LIBHAL_TASK_FRAME_COUNT> held{};
+    for (auto& slot : held) {
+      slot.emplace(three_step_task());
+    }
+
+    // Exercise
+    auto overflow = three_step_task();
+    auto poll = overflow();
+
+    // Verify
+    expect(!bool{ poll });
+    expect(!bool{ overflow.value() });
+    // Destroying a held task returns its frame to the pool
+    held.front().reset();
+    auto replacement = three_step_task();
+    expect(work_state::in_progress == replacement().value());
+  };
+};
+}  // namespace hal
@@ -0,0 +1,166 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/telemetry.hpp>
+
+#include <numeric>
+#include <vector>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+class recording_serial : public hal::serial
+{
+public:
+  std::vector<hal::byte> m_written{};
+  int m_write_calls{ 0 };
+
+  ~recording_serial() override = default;
+
+private:
+  status driver_configure(const settings&) override
+  {
+    return success();
+  };
+
+  result<write_t> driver_write(std::span<const hal::byte> p_data) override
+  {
+    m_write_calls++;
+    m_written.insert(m_written.end(), p_data.begin(), p_data.end());
+    return write_t{ .data = p_data };
+  };
+
+  result<read_t> driver_read(std::span<hal::byte> p_data) override
+  {
+    return read_t{ .data = p_data.first(0), .available = 0, .capacity = 0 };
+  };
+
+  result<flush_t> driver_flush() override
+  {
+    return flush_t{};
+  };
+};
+
+class fixed_clock : public hal::steady_clock
+{
+public:
+  std::uint64_t m_ticks{ 0 };
+
+  ~fixed_clock() override = default;
+
+private:
+  frequency_t driver_frequency() override
+  {
+    return frequency_t{ .operating_frequency = 1'000'000.0f };
+  };
+
+  uptime_t driver_uptime() override
+  {
+    return uptime_t{ .ticks = m_ticks };
+  };
+};
+
+hal::byte record_sum(std::span<const hal::byte> p_record)
+{
+  return std::accumulate(
+    p_record.begin(), p_record.end(), hal::byte{ 0 }, [](auto p_a, auto p_b) {
+      return static_cast<hal::byte>(p_a + p_b);
+    });
+}
+}  // namespace
+
+void telemetry_test()
+{
+  using namespace boost::ut;
+  "telemetry f32 record test"_test = []() {
+    // Setup
+    recording_serial port;
+    fixed_clock clock;
+    clock.m_ticks = 0x0102'0304'0506'0708;
+    telemetry_encoder encoder(port, clock);
+
+    // Exercise
+    auto result = encoder.write(hal::byte{ 7 }, 1.0f);
+
+    // Verify
+    expect(bool{ result });
+    expect(that % 1 == port.m_write_calls);
+    expect(that % size_t{ 17 } == port.m_written.size());
+    expect(that % hal::byte{ 0xA5 } == port.m_written[0]);
+    expect(that % hal::byte{ 7 } == port.m_written[1]);
+    expect(that % hal::byte{ 1 } == port.m_written[2]);  // telemetry_type::f32
+    expect(that % hal::byte{ 4 } == port.m_written[3]);
+    // Timestamp is little-endian
+    expect(that % hal::byte{ 0x08 } == port.m_written[4]);
+    expect(that % hal::byte{ 0x01 } == port.m_written[11]);
+    // 1.0f is 0x3F800000, little-endian
+    expect(that % hal::byte{ 0x00 } == port.m_written[12]);
+    expect(that % hal::byte{ 0x80 } == port.m_written[14]);
+    expect(that % hal::byte{ 0x3F } == port.m_written[15]);
+    // A whole record including its checksum sums to zero
+    expect(that % hal::byte{ 0 } == record_sum(port.m_written));
+  };
+
+  "telemetry vec3 and u32 record test"_test = []() {
+    // Setup
+    recording_serial port;
+    fixed_clock clock;
+    telemetry_encoder encoder(port, clock);
+
+    // Exercise
+    auto result1 =
+      encoder.write(hal::byte{ 1 }, vec3{ .x = 1.0f, .y = 2.0f, .z = 3.0f });
+    auto vec3_record = port.m_written;
+    port.m_written.clear();
+    auto result2 = encoder.write(hal::byte{ 2 }, std::uint32_t{ 0xAABB });
+
+    // Verify
+    expect(bool{ result1 });
+    expect(bool{ result2 });
+    expect(that % size_t{ 25 } == vec3_record.size());
+    expect(that % hal::byte{ 2 } == vec3_record[2]);  // telemetry_type::vec3
+    expect(that % hal::byte{ 12 } == vec3_record[3]);
+    expect(that % hal::byte{ 0 } == record_sum(vec3_record));
+    expect(that % size_t{ 17 } == port.m_written.size());
+    expect(that % hal::byte{ 3 } == port.m_written[2]);  // telemetry_type::u32
+    expect(that % hal::byte{ 0xBB } == port.m_written[12]);
+    expect(that % hal::byte{ 0xAA } == port.m_written[13]);
+    expect(that % hal::byte{ 0 } == record_sum(port.m_written));
+  };
+
+  "telemetry bytes record test"_test = []() {
+    // Setup
+    recording_serial port;
+    fixed_clock clock;
+    telemetry_encoder encoder(port, clock);
+    const std::array<hal::byte, 3> payload{ 'a', 'b', 'c' };
+    std::array<hal::byte, 300> oversized{};
+
+    // Exercise
+    auto result1 = encoder.write(hal::byte{ 9 }, payload);
+    auto result2 = encoder.write(hal::byte{ 9 }, oversized);
+
+    // Verify
+    expect(bool{ result1 });
+    expect(!bool{ result2 });
+    expect(that % size_t{ 16 } == port.m_written.size());
+    expect(that % hal::byte{ 4 } ==
+           port.m_written[2]);  // telemetry_type::bytes
+    expect(that % hal::byte{ 3 } == port.m_written[3]);
+    expect(that % hal::byte{ 'a' } == port.m_written[12]);
+    expect(that % hal::byte{ 0 } == record_sum(port.m_written));
+  };
+};
+}  // namespace hal
@@ -17,6 +17,24 @@
 #include <boost/ut.hpp>
 
 namespace hal {
+namespace {
+class fake_steady_clock : public hal::steady_clock
+{
+public:
+  std::uint64_t m_ticks{ 0 };
+
+private:
+  frequency_t driver_frequency() override
+  {
+    return frequency_t{ .operating_frequency = 1'000'000.0f };
+  };
+  uptime_t driver_uptime() override
+  {
+    return uptime_t{ .ticks = m_ticks++ };
+  };
+};
+}  // namespace
+
 void timeout_test()
 {
   using namespace boost::ut;
@@ -47,6 +65,31 @@ void timeout_test()
     expect(bool{ result });
   };
 
+  "hal::deadline test"_test = []() {
+    // Setup
+    fake_steady_clock clock;
+    // 10us at 1MHz is a deadline 10 ticks from now
+    hal::deadline deadline(clock, std::chrono::microseconds(10));
+
+    // Exercise + Verify
+    expect(bool{ deadline() });
+    clock.m_ticks = 100;
+    expect(!bool{ deadline() });
+  };
+
+  "hal::deadline works with hal::delay"_test = []() {
+    // Setup
+    fake_steady_clock clock;
+    hal::deadline deadline(clock, std::chrono::microseconds(5));
+
+    // Exercise
+    auto result = hal::delay(deadline);
+
+    // Verify
+    expect(bool{ result });
+    expect(that % std::uint64_t{ 5 } <= clock.m_ticks);
+  };
+
   "hal::delay(timeout) returns error"_test = []() {
     // Setup
     auto test_timeout_function = []() mutable -> status {
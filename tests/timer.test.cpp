@@ -56,6 +56,54 @@ private:
     return schedule_t{};
   };
 };
+
+class test_repeating_timer : public test_timer
+{
+public:
+  hal::time_duration m_period{};
+
+private:
+  result<schedule_t> driver_schedule_repeating(
+    hal::callback<void(void)> p_callback,
+    hal::time_duration p_period) override
+  {
+    m_is_running = true;
+    m_callback = p_callback;
+    m_period = p_period;
+    return schedule_t{};
+  };
+};
+
+class test_tick_timer : public test_timer
+{
+public:
+  std::uint32_t m_ticks{ 0 };
+
+private:
+  result<tick_period_t> driver_tick_period() override
+  {
+    return tick_period_t{ .period = std::chrono::microseconds(1) };
+  };
+  result<schedule_t> driver_schedule_ticks(hal::callback<void(void)> p_callback,
+                                           std::uint32_t p_ticks) override
+  {
+    m_is_running = true;
+    m_callback = p_callback;
+    m_ticks = p_ticks;
+    return schedule_t{};
+  };
+};
+
+// Reports a tick period but keeps the default tick-native scheduling,
+// exercising the conversion fallback onto driver_schedule().
+class test_period_only_timer : public test_timer
+{
+private:
+  result<tick_period_t> driver_tick_period() override
+  {
+    return tick_period_t{ .period = std::chrono::microseconds(1) };
+  };
+};
 }  // namespace
 
 void timer_test()
@@ -92,6 +140,88 @@ void timer_test()
     expect(bool{ result3 });
     expect(that % false == result1.value().is_running);
   };
+  "timer schedule_repeating test"_test = []() {
+    // Setup
+    test_repeating_timer test;
+    int counter = 0;
+    const hal::callback<void(void)> expected_callback = [&counter]() {
+      counter++;
+    };
+    const hal::time_duration expected_period = std::chrono::milliseconds(1);
+
+    // Exercise
+    auto result = test.schedule_repeating(expected_callback, expected_period);
+    test.m_callback();
+    test.m_callback();
+
+    // Verify
+    expect(bool{ result });
+    expect(expected_period == test.m_period);
+    expect(that % 2 == counter);
+  };
+
+  "timer schedule_repeating default unsupported test"_test = []() {
+    // Setup
+    test_timer test;
+
+    // Exercise
+    auto result = test.schedule_repeating([]() {}, hal::time_duration{});
+
+    // Verify
+    expect(!bool{ result });
+  };
+
+  "timer schedule_ticks native test"_test = []() {
+    // Setup
+    test_tick_timer test;
+    int counter = 0;
+    const hal::callback<void(void)> expected_callback = [&counter]() {
+      counter++;
+    };
+
+    // Exercise
+    auto period = test.tick_period();
+    auto result = test.schedule_ticks(expected_callback, 250);
+    test.m_callback();
+
+    // Verify
+    expect(bool{ period });
+    expect(std::chrono::microseconds(1) == period.value().period);
+    expect(bool{ result });
+    expect(that % 250 == test.m_ticks);
+    expect(that % 1 == counter);
+  };
+
+  "timer schedule_ticks default conversion test"_test = []() {
+    // Setup
+    test_period_only_timer test;
+
+    // Exercise
+    auto result1 = test.schedule_ticks([]() {}, 250);
+    // Default repeating path converts then reports the base class's lack of
+    // repeat support
+    auto result2 = test.schedule_repeating_ticks([]() {}, 250);
+
+    // Verify
+    expect(bool{ result1 });
+    expect(std::chrono::microseconds(250) == test.m_delay);
+    expect(!bool{ result2 });
+  };
+
+  "timer tick_period default unsupported test"_test = []() {
+    // Setup
+    test_timer test;
+
+    // Exercise
+    auto result1 = test.tick_period();
+    // Without a tick period the default tick-native schedule cannot convert
+    auto result2 = test.schedule_ticks([]() {}, 250);
+
+    // Verify
+    expect(!bool{ result1 });
+    expect(!bool{ result2 });
+  };
+
   "timer errors test"_test = []() {
     // Setup
     test_timer test;
@@ -0,0 +1,190 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/timer_wheel.hpp>
+
+#include <chrono>
+
+#include "helpers.hpp"
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+class fake_timer : public hal::timer
+{
+public:
+  bool m_is_running{ false };
+  hal::callback<void(void)> m_callback = []() {};
+  hal::time_duration m_delay{};
+
+  void fire()
+  {
+    m_is_running = false;
+    m_callback();
+  }
+
+private:
+  result<is_running_t> driver_is_running() override
+  {
+    return is_running_t{ .is_running = m_is_running };
+  };
+  result<cancel_t> driver_cancel() override
+  {
+    m_is_running = false;
+    return cancel_t{};
+  };
+  result<schedule_t> driver_schedule(hal::callback<void(void)> p_callback,
+                                     hal::time_duration p_delay) override
+  {
+    m_is_running = true;
+    m_callback = p_callback;
+    m_delay = p_delay;
+    return schedule_t{};
+  };
+};
+
+// The mock clock runs at 1 MHz: 1000 ticks per millisecond
+constexpr std::uint64_t ticks_per_millisecond = 1000;
+}  // namespace
+
+void timer_wheel_test()
+{
+  using namespace boost::ut;
+  using namespace std::chrono_literals;
+
+  "timer_wheel schedules earliest deadline test"_test = []() {
+    // Setup
+    fake_timer timer;
+    mock::steady_clock clock;
+    hal::timer_wheel<4> wheel(timer, clock);
+    int first_count = 0;
+    int second_count = 0;
+
+    // Exercise
+    auto result1 = wheel.schedule([&first_count]() { first_count++; }, 10ms);
+    auto result2 = wheel.schedule([&second_count]() { second_count++; }, 5ms);
+    expect(bool{ result1 });
+    expect(bool{ result2 });
+    // The hardware timer must be armed for the earlier 5ms deadline
+    expect(5ms == timer.m_delay);
+
+    clock.advance(5 * ticks_per_millisecond);
+    timer.fire();
+    expect(that % 0 == first_count);
+    expect(that % 1 == second_count);
+    // Re-armed for the remaining 5ms until the 10ms deadline
+    expect(5ms == timer.m_delay);
+
+    clock.advance(5 * ticks_per_millisecond);
+    timer.fire();
+
+    // Verify
+    expect(that % 1 == first_count);
+    expect(that % 1 == second_count);
+    expect(that % false == timer.m_is_running);
+  };
+
+  "timer_wheel mid-flight schedule keeps deadlines test"_test = []() {
+    // Setup
+    fake_timer timer;
+    mock::steady_clock clock;
+    hal::timer_wheel<4> wheel(timer, clock);
+    int first_count = 0;
+    int second_count = 0;
+
+    // Exercise
+    // Schedule A for t=100ms, then 90ms later schedule B for t=140ms
+    auto result1 = wheel.schedule([&first_count]() { first_count++; }, 100ms);
+    clock.advance(90 * ticks_per_millisecond);
+    auto result2 = wheel.schedule([&second_count]() { second_count++; }, 50ms);
+    expect(bool{ result1 });
+    expect(bool{ result2 });
+    // Re-arming must account for the elapsed 90ms: A is due in 10ms
+    expect(10ms == timer.m_delay);
+
+    clock.advance(10 * ticks_per_millisecond);
+    timer.fire();
+    expect(that % 1 == first_count);
+    expect(that % 0 == second_count);
+    // B keeps its original t=140ms deadline, 40ms from now
+    expect(40ms == timer.m_delay);
+
+    clock.advance(40 * ticks_per_millisecond);
+    timer.fire();
+
+    // Verify
+    expect(that % 1 == first_count);
+    expect(that % 1 == second_count);
+    expect(that % false == timer.m_is_running);
+  };
+
+  "timer_wheel cancel test"_test = []() {
+    // Setup
+    fake_timer timer;
+    mock::steady_clock clock;
+    hal::timer_wheel<2> wheel(timer, clock);
+    int count = 0;
+
+    // Exercise
+    auto scheduled = wheel.schedule([&count]() { count++; }, 5ms);
+    expect(bool{ scheduled });
+    auto cancelled = wheel.cancel(scheduled.value().id);
+
+    // Verify
+    expect(bool{ cancelled });
+    expect(that % false == timer.m_is_running);
+    expect(!bool{ wheel.cancel(100) });
+  };
+
+  "timer_wheel mid-flight cancel keeps deadlines test"_test = []() {
+    // Setup
+    fake_timer timer;
+    mock::steady_clock clock;
+    hal::timer_wheel<2> wheel(timer, clock);
+    int count = 0;
+
+    // Exercise
+    // Cancel the earlier timeout 30ms in: the later one is due 70ms later
+    auto kept = wheel.schedule([&count]() { count++; }, 100ms);
+    auto dropped = wheel.schedule([]() {}, 50ms);
+    expect(bool{ kept });
+    expect(bool{ dropped });
+    clock.advance(30 * ticks_per_millisecond);
+    auto cancelled = wheel.cancel(dropped.value().id);
+
+    // Verify
+    expect(bool{ cancelled });
+    expect(70ms == timer.m_delay);
+    clock.advance(70 * ticks_per_millisecond);
+    timer.fire();
+    expect(that % 1 == count);
+  };
+
+  "timer_wheel capacity test"_test = []() {
+    // Setup
+    fake_timer timer;
+    mock::steady_clock clock;
+    hal::timer_wheel<1> wheel(timer, clock);
+
+    // Exercise
+    auto result1 = wheel.schedule([]() {}, 1ms);
+    auto result2 = wheel.schedule([]() {}, 2ms);
+
+    // Verify
+    expect(bool{ result1 });
+    expect(!bool{ result2 });
+  };
+};
+}  // namespace hal
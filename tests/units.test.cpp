@@ -0,0 +1,49 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/units.hpp>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+void units_test()
+{
+  using namespace boost::ut;
+  using namespace std::chrono_literals;
+
+  "duration to ticks conversion test"_test = []() {
+    // Verify: exact at frequencies float hertz cannot represent
+    static_assert(duration_to_ticks(96'000'000, 1s) == 96'000'000);
+    static_assert(duration_to_ticks(96'000'000, 1ms) == 96'000);
+    static_assert(duration_to_ticks(96'000'000, 1us) == 96);
+    // Sub-tick durations round down
+    static_assert(duration_to_ticks(1'000'000, 999ns) == 0);
+    // Negative durations convert to zero
+    static_assert(duration_to_ticks(96'000'000, -5ms) == 0);
+    // Long durations do not overflow: one hour at 96 MHz
+    static_assert(duration_to_ticks(96'000'000, 1h) ==
+                  std::uint64_t{ 96'000'000 } * 3600);
+  };
+
+  "ticks to duration conversion test"_test = []() {
+    // Verify
+    static_assert(ticks_to_duration(96'000'000, 96'000'000) == 1s);
+    static_assert(ticks_to_duration(96'000'000, 96) == 1us);
+    static_assert(ticks_to_duration(1'000'000'000, 1) == 1ns);
+    // Round trip is exact when the duration is a whole number of ticks
+    constexpr auto ticks = duration_to_ticks(96'000'000, 250us);
+    static_assert(ticks_to_duration(96'000'000, ticks) == 250us);
+  };
+}
+}  // namespace hal
@@ -0,0 +1,69 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <libhal/vec3.hpp>
+
+#include <libhal/accelerometer.hpp>
+#include <libhal/gyroscope.hpp>
+#include <libhal/magnetometer.hpp>
+
+#include <boost/ut.hpp>
+
+namespace hal {
+namespace {
+static_assert(alignof(vec3) == 16);
+static_assert(sizeof(vec3) == 16);
+// All three x/y/z sensor interfaces share the vec3 sample layout
+static_assert(std::is_same_v<accelerometer::read_t, vec3>);
+static_assert(std::is_same_v<gyroscope::read_t, vec3>);
+static_assert(std::is_same_v<magnetometer::read_t, vec3>);
+}  // namespace
+
+void vec3_test()
+{
+  using namespace boost::ut;
+
+  "vec3 arithmetic test"_test = []() {
+    // Setup
+    constexpr vec3 first{ .x = 1.0f, .y = 2.0f, .z = 3.0f };
+    constexpr vec3 second{ .x = 4.0f, .y = 5.0f, .z = 6.0f };
+
+    // Exercise
+    constexpr auto sum = first + second;
+    constexpr auto difference = second - first;
+    constexpr auto scaled = first * 2.0f;
+    constexpr auto divided = scaled / 2.0f;
+    constexpr auto dotted = dot(first, second);
+
+    // Verify
+    expect(sum == vec3{ .x = 5.0f, .y = 7.0f, .z = 9.0f });
+    expect(difference == vec3{ .x = 3.0f, .y = 3.0f, .z = 3.0f });
+    expect(scaled == vec3{ .x = 2.0f, .y = 4.0f, .z = 6.0f });
+    expect(divided == first);
+    expect(that % 32.0f == dotted);
+  };
+
+  "vec3 compound assignment test"_test = []() {
+    // Setup
+    vec3 value{ .x = 1.0f, .y = 1.0f, .z = 1.0f };
+
+    // Exercise
+    value += vec3{ .x = 1.0f, .y = 2.0f, .z = 3.0f };
+    value *= 2.0f;
+
+    // Verify
+    expect(value == vec3{ .x = 4.0f, .y = 6.0f, .z = 8.0f });
+  };
+};
+}  // namespace hal